@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <optional>
@@ -25,6 +26,7 @@
 #include "config/b4g_config.h"
 #include "config/pgm_conf.h"
 #include "diagnostic_counter.h"
+#include "lib_config.h"
 #include "nlohmann/json.hpp"
 #include "utils/path.h"
 #include "utils/path_conversions.h"
@@ -32,6 +34,7 @@
 #include "utils/resource_location.h"
 #include "utils/unicode_text.h"
 #include "workspace_manager.h"
+#include "workspace_manager_response.h"
 
 /*
  * The benchmark is used to evaluate multiple aspects about the performance and accuracy of the parse library.
@@ -47,6 +50,8 @@
  * -s            - Skips reparsing of each file
  * -m message    - Prepends message before every log entry related to parsed files
  * -g path       - Specifies a path to the folder with .bridge.json
+ * -t prefix     - Records macro entries/exits and writes them to <prefix><n>.json (Chrome trace-event format) and
+ *                 <prefix><n>.folded (folded stacks for flame graphs), where n is the index of the parsed file
  *
  * Collected metrics:
  * - File                     - File name
@@ -70,6 +75,8 @@
  *as one continued statement)
  * - Non-continued Statements - Number of statements that were not continued
  * - Lines                    - Total number of lines
+ * - Opcode Cache Hit Rate     - Share of opcode lookups answered by the opcode cache
+ * - Mach Evaluation Cache Hit Rate - Share of machine operator evaluations answered by the evaluation cache
  * - Files                    - Total number of parsed files
  */
 
@@ -124,6 +131,8 @@ public:
     std::string message;
     std::vector<std::string> pgm_names;
     std::optional<std::string> b4g_pgms_dir = std::nullopt;
+    std::string macro_trace_prefix;
+    static constexpr size_t macro_trace_events = 1 << 20;
 
     bool load(int argc, char** argv)
     {
@@ -144,6 +153,7 @@ public:
             log_i("write_details: ", write_details);
             log_i("do_reparse: ", do_reparse);
             log_i("message: ", message);
+            log_i("macro_trace_prefix: ", macro_trace_prefix);
             log_if("number of pgms: ", pgm_names.size(), "\n\n");
         }
     }
@@ -213,6 +223,11 @@ private:
                 if (!advance_and_retrieve(arg, i, message))
                     return false;
             }
+            else if (arg == "-t") // Exports macro traces of parsed files
+            {
+                if (!advance_and_retrieve(arg, i, macro_trace_prefix))
+                    return false;
+            }
             else
             {
                 log_e("Unknown parameter ", arg);
@@ -340,12 +355,14 @@ public:
             log_i("Analyzer crashes (reparsing): ", s.reparsing_crashes);
             log_i("Failed program opens: ", s.failed_file_opens);
             log_i("Benchmark time: ", s.whole_time, " ms");
+            log_i("Programs/s: ", s.programs_per_second());
             log_i("Average statement/ms: ", s.average_stmt_ms / (double)bc.pgm_names.size());
             log_if("Average line/ms: ", s.average_line_ms / (double)bc.pgm_names.size(), "\n\n");
 
             std::cout << json({ { "Programs", s.program_count },
                                   { "Benchmarked files", s.all_files },
                                   { "Benchmark time(ms)", s.whole_time },
+                                  { "Programs/s", s.programs_per_second() },
                                   { "Analyzer crashes", s.parsing_crashes },
                                   { "Failed program opens", s.failed_file_opens },
                                   { "Average statement/ms", s.average_stmt_ms / bc.pgm_names.size() },
@@ -369,6 +386,11 @@ private:
         size_t parsing_crashes = 0;
         size_t reparsing_crashes = 0;
         size_t failed_file_opens = 0;
+
+        double programs_per_second() const
+        {
+            return whole_time ? (double)program_count * 1000. / (double)whole_time : 0.;
+        }
     };
 
     struct parse_time_stats
@@ -392,12 +414,19 @@ private:
         const std::string& source_file;
         std::string source_path;
         std::string annotation;
+        std::string macro_trace_prefix;
 
         parse_parameters(const std::string& source_file, size_t current_iteration, const bench_configuration& bc)
             : source_file(source_file)
             , source_path(utils::path::join(bc.ws_folder, source_file).string())
         {
             annotation = get_file_message(current_iteration, bc);
+            if (!bc.macro_trace_prefix.empty())
+            {
+                macro_trace_prefix = bc.macro_trace_prefix + std::to_string(current_iteration);
+                ws->configuration_changed(parser_library::lib_config::load_from_json(
+                    json { { "macroTraceEvents", bench_configuration::macro_trace_events } }));
+            }
             ws->register_diagnostics_consumer(&diag_counter);
             ws->register_parsing_metadata_consumer(&collector);
             ws->add_workspace(bc.ws_folder.c_str(), utils::path::path_to_uri(bc.ws_folder).c_str());
@@ -433,6 +462,9 @@ private:
         if (!init_parse_res)
             return json_res;
 
+        if (!parse_params.macro_trace_prefix.empty())
+            export_macro_traces(parse_params);
+
         auto first_ws_info = parse_params.collector.data.front().ws_info;
         auto first_parse_top_messages = benchmark::get_top_messages(parse_params.diag_counter.message_counts);
         auto first_parse_metrics = parse_params.collector.data.front().metrics;
@@ -470,6 +502,8 @@ private:
             log_i("Continued Statements: ", first_parse_metrics.continued_statements);
             log_i("Non-continued Statements: ", first_parse_metrics.non_continued_statements);
             log_i("Lines: ", first_parse_metrics.lines);
+            log_i("Opcode Cache Hit Rate: ", first_parse_metrics.opcode_cache_hit_rate());
+            log_i("Mach Evaluation Cache Hit Rate: ", first_parse_metrics.mach_evaluation_cache_hit_rate());
             log_i("Executed Statement/ms: ", (double)exec_statements / (double)parse_time);
             log_i("Line/ms: ", (double)first_parse_metrics.lines / (double)parse_time);
             log_i("Files: ", first_ws_info.files_processed);
@@ -544,6 +578,8 @@ private:
                 { "Continued Statements", metrics.continued_statements },
                 { "Non-continued Statements", metrics.non_continued_statements },
                 { "Lines", metrics.lines },
+                { "Opcode Cache Hit Rate", metrics.opcode_cache_hit_rate() },
+                { "Mach Evaluation Cache Hit Rate", metrics.mach_evaluation_cache_hit_rate() },
                 { "Files", files_processed },
             }),
             time,
@@ -584,6 +620,39 @@ private:
         };
     }
 
+    void export_macro_traces(parse_parameters& parse_params)
+    {
+        struct trace_response
+        {
+            std::string* target;
+
+            void provide(parser_library::continuous_sequence<char> trace) const
+            {
+                target->assign(trace.data(), trace.size());
+            }
+            void error(int, const char* msg) const noexcept { log_e("Macro trace: ", msg); }
+        };
+
+        const auto source_uri = utils::path::path_to_uri(parse_params.source_path);
+        for (const auto& [format, ext] : {
+                 std::pair(parser_library::macro_trace_format::chrome_trace, ".json"),
+                 std::pair(parser_library::macro_trace_format::folded_stacks, ".folded"),
+             })
+        {
+            std::string trace;
+            parse_params.ws->macro_trace(source_uri.c_str(),
+                format,
+                parser_library::make_workspace_manager_response(trace_response { &trace }).first);
+            parse_params.ws->idle_handler();
+
+            const auto filename = parse_params.macro_trace_prefix + ext;
+            if (std::ofstream out(filename, std::ios::binary); out)
+                out << trace;
+            else
+                log_e("Unable to write macro trace: ", filename);
+        }
+    }
+
     std::optional<parse_time_stats> parse(parse_parameters& parse_params, const std::string& content, bool reparse)
     {
         std::string annotation;
@@ -76,7 +76,7 @@ dap_feature::dap_feature(parser_library::debugger_configuration_provider& dc_pro
 {}
 
 
-void dap_feature::register_methods(std::map<std::string, method>& methods)
+void dap_feature::register_methods(std::map<std::string, method, std::less<>>& methods)
 {
     using enum telemetry_log_level;
     const auto add_method = [this, &methods](std::string_view name,
@@ -274,6 +274,7 @@ void dap_feature::on_scopes(const request_id& request_seq, const nlohmann::json&
         auto scope_json = nlohmann::json {
             { "name", std::string_view(scope.name) },
             { "variablesReference", scope.variable_reference },
+            { "namedVariables", scope.named_variables },
             { "expensive", false },
             { "source", source_to_json(scope.source_file, client_path_format_) },
         };
@@ -319,7 +320,10 @@ void dap_feature::on_variables(const request_id& request_seq, const nlohmann::js
 
     nlohmann::json variables_json = nlohmann::json::array();
 
-    for (auto var : debugger->variables(parser_library::var_reference_t(args.at("variablesReference"))))
+    const auto start = args.value<size_t>("start", 0);
+    const auto count = args.value<size_t>("count", 0);
+
+    for (auto var : debugger->variables(parser_library::var_reference_t(args.at("variablesReference")), start, count))
     {
         std::string type;
         switch (var.type)
@@ -69,7 +69,7 @@ public:
 
 private:
     // Inherited via feature
-    void register_methods(std::map<std::string, method>& methods) override;
+    void register_methods(std::map<std::string, method, std::less<>>& methods) override;
     nlohmann::json register_capabilities() override;
 
     // Inherited via debug_event_consumer
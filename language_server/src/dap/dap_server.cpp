@@ -93,7 +93,7 @@ void server::message_received(const nlohmann::json& message)
             send_telemetry_error("dap_server/invalid_message");
             return;
         }
-        call_method(message.at("command").get<std::string>(),
+        call_method(message.at("command").get_ref<const std::string&>(),
             message.at("seq").get<request_id>(),
             message.value("arguments", nlohmann::json()));
     }
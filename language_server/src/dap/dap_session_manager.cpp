@@ -100,11 +100,5 @@ void session_manager::write(nlohmann::json&& msg)
             handle_registration_request(new_id.value());
     }
 }
-message_router::message_predicate session_manager::get_filtering_predicate() const
-{
-    return [](const nlohmann::json& msg) {
-        auto method = extract_method(msg);
-        return method.substr(0, dap::broadcom_tunnel_method.size()) == dap::broadcom_tunnel_method;
-    };
-}
+std::string session_manager::get_route_prefix() const { return std::string(broadcom_tunnel_method); }
 } // namespace hlasm_plugin::language_server::dap
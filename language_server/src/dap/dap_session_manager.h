@@ -18,9 +18,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
 
 #include "../json_channel.h"
-#include "../message_router.h"
 #include "workspace_manager.h"
 
 namespace hlasm_plugin::language_server {
@@ -55,7 +55,8 @@ public:
     void write(const nlohmann::json& msg) override;
     void write(nlohmann::json&& msg) override;
 
-    [[nodiscard]] message_router::message_predicate get_filtering_predicate() const;
+    // the method name prefix of the messages for the sessions
+    [[nodiscard]] std::string get_route_prefix() const;
 
     [[nodiscard]] size_t registered_sessions_count() const { return sessions.size(); }
 };
@@ -26,7 +26,6 @@ using namespace hlasm_plugin::parser_library;
 namespace hlasm_plugin::language_server {
 
 constexpr std::string_view request_type_message = "external_file_request";
-constexpr std::string_view response_type_message = "external_file_response";
 
 namespace {
 constexpr std::pair<int, const char*> unknown_error { -1, "Unknown error" };
@@ -163,17 +162,6 @@ external_file_reader::thread_registration external_file_reader::register_thread(
     return thread_registration(*this);
 }
 
-namespace {
-std::string_view extract_method(const nlohmann::json& msg)
-{
-    auto method_ptr = msg.find("method");
-    if (method_ptr != msg.end() && method_ptr->is_string())
-        return method_ptr->get<std::string_view>();
-    else
-        return {};
-}
-} // namespace
-
 void external_file_reader::write(const nlohmann::json& msg)
 {
     const auto params = msg.find("params");
@@ -201,11 +189,6 @@ void external_file_reader::write(const nlohmann::json& msg)
 
 void external_file_reader::write(nlohmann::json&& msg) { write(msg); }
 
-message_router::message_predicate external_file_reader::get_filtering_predicate() const
-{
-    return [](const nlohmann::json& msg) { return extract_method(msg) == response_type_message; };
-}
-
 external_file_reader::thread_registration::~thread_registration()
 {
     if (!m_self)
@@ -18,13 +18,14 @@
 #include <atomic>
 #include <functional>
 #include <mutex>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <unordered_map>
 #include <utility>
 
 #include "json_channel.h"
 
-#include "message_router.h"
 #include "nlohmann/json_fwd.hpp"
 #include "sequence.h"
 #include "workspace_manager_external_file_requests.h"
@@ -81,7 +82,10 @@ public:
     void write(const nlohmann::json&) override;
     void write(nlohmann::json&&) override;
 
-    message_router::message_predicate get_filtering_predicate() const;
+    static constexpr std::string_view response_method = "external_file_response";
+
+    // the method name the reader expects to be routed to it
+    std::string get_route_method() const { return std::string(response_method); }
 };
 
 } // namespace hlasm_plugin::language_server
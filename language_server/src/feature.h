@@ -155,7 +155,7 @@ public:
     {}
 
     // Implement to add methods to server.
-    virtual void register_methods(std::map<std::string, method>& methods) = 0;
+    virtual void register_methods(std::map<std::string, method, std::less<>>& methods) = 0;
     // Implement to add json object to server capabilities that are sent to LSP client
     // in the response to initialize request.
     virtual nlohmann::json register_capabilities() = 0;
@@ -220,7 +220,7 @@ feature_language_features::feature_language_features(
     , ws_mngr_(ws_mngr)
 {}
 
-void feature_language_features::register_methods(std::map<std::string, method>& methods)
+void feature_language_features::register_methods(std::map<std::string, method, std::less<>>& methods)
 {
     using enum telemetry_log_level;
     const auto add_method = [this, &methods](std::string_view name,
@@ -239,6 +239,7 @@ void feature_language_features::register_methods(std::map<std::string, method>&
     add_method("textDocument/$/opcode_suggestion", &feature_language_features::opcode_suggestion);
     add_method("textDocument/$/branch_information", &feature_language_features::branch_information);
     add_method("textDocument/foldingRange", &feature_language_features::folding);
+    add_method("textDocument/$/macro_trace", &feature_language_features::macro_trace);
 }
 
 nlohmann::json feature_language_features::register_capabilities()
@@ -805,4 +806,21 @@ void feature_language_features::folding(const request_id& id, const nlohmann::js
 
     response_->register_cancellable_request(id, std::move(resp));
 }
+
+void feature_language_features::macro_trace(const request_id& id, const nlohmann::json& params)
+{
+    auto document_uri = extract_document_uri(params);
+    auto format = params.value("format", "") == "folded" ? macro_trace_format::folded_stacks
+                                                         : macro_trace_format::chrome_trace;
+
+    auto resp = make_response(id, response_, [](continuous_sequence<char> trace) {
+        return nlohmann::json {
+            { "trace", std::string_view(trace.data(), trace.size()) },
+        };
+    });
+
+    ws_mngr_.macro_trace(document_uri.c_str(), format, resp);
+
+    response_->register_cancellable_request(id, std::move(resp));
+}
 } // namespace hlasm_plugin::language_server::lsp
@@ -32,7 +32,7 @@ class feature_language_features : public feature
 public:
     feature_language_features(parser_library::workspace_manager& ws_mngr, response_provider& response_provider);
 
-    void register_methods(std::map<std::string, method>& methods) override;
+    void register_methods(std::map<std::string, method, std::less<>>& methods) override;
     nlohmann::json register_capabilities() override;
     void initialize_feature(const nlohmann::json& initialise_params) override;
 
@@ -49,6 +49,7 @@ private:
     void opcode_suggestion(const request_id& id, const nlohmann::json& params);
     void branch_information(const request_id& id, const nlohmann::json& params);
     void folding(const request_id& id, const nlohmann::json& params);
+    void macro_trace(const request_id& id, const nlohmann::json& params);
 
     nlohmann::json document_symbol_item_json(hlasm_plugin::parser_library::document_symbol_item symbol);
     nlohmann::json document_symbol_list_json(hlasm_plugin::parser_library::document_symbol_list symbol_list);
@@ -29,7 +29,7 @@ feature_text_synchronization::feature_text_synchronization(
     , ws_mngr_(ws_mngr)
 {}
 
-void feature_text_synchronization::register_methods(std::map<std::string, method>& methods)
+void feature_text_synchronization::register_methods(std::map<std::string, method, std::less<>>& methods)
 {
     methods.try_emplace("textDocument/didOpen",
         method { [this](const nlohmann::json& args) { on_did_open(args); }, telemetry_log_level::LOG_EVENT });
@@ -40,7 +40,7 @@ public:
     feature_text_synchronization(parser_library::workspace_manager& ws_mngr, response_provider& response_provider);
 
     // Adds the implemented methods into the map.
-    void register_methods(std::map<std::string, method>& methods) override;
+    void register_methods(std::map<std::string, method, std::less<>>& methods) override;
     // Returns set capabilities connected with text synchonization
     nlohmann::json register_capabilities() override;
     // Does nothing, not needed.
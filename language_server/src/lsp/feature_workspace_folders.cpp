@@ -29,7 +29,7 @@ feature_workspace_folders::feature_workspace_folders(
     , ws_mngr_(ws_mngr)
 {}
 
-void feature_workspace_folders::register_methods(std::map<std::string, method>& methods)
+void feature_workspace_folders::register_methods(std::map<std::string, method, std::less<>>& methods)
 {
     methods.try_emplace("workspace/didChangeWorkspaceFolders",
         method { [this](const nlohmann::json& args) { on_did_change_workspace_folders(args); },
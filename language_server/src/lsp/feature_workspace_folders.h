@@ -32,7 +32,7 @@ public:
         parser_library::workspace_manager& ws_mngr, response_provider& response_provider);
 
     // Adds workspace/* methods to the map.
-    void register_methods(std::map<std::string, method>&) override;
+    void register_methods(std::map<std::string, method, std::less<>>&) override;
     // Returns workspaces capability.
     nlohmann::json register_capabilities() override;
     // Opens workspace specified in the initialize request.
@@ -143,7 +143,7 @@ void server::message_received(const nlohmann::json& message)
         try
         {
             auto params_found = message.find("params");
-            call_method(method_found.value().get<std::string>(),
+            call_method(method_found->get_ref<const std::string&>(),
                 std::move(id),
                 params_found == message.end() ? nlohmann::json() : params_found.value());
         }
@@ -84,9 +84,9 @@ public:
         , dap_sessions(*this, json_output, &dap_telemetry_broker)
         , virtual_files(*ws_mngr, json_output)
     {
-        router.register_route(dap_sessions.get_filtering_predicate(), dap_sessions);
-        router.register_route(virtual_files.get_filtering_predicate(), virtual_files);
-        router.register_route(external_files.get_filtering_predicate(), external_files);
+        router.register_method_prefix_route(dap_sessions.get_route_prefix(), dap_sessions);
+        router.register_method_route(virtual_files.get_route_method(), virtual_files);
+        router.register_method_route(external_files.get_route_method(), external_files);
 
         lsp_thread = std::thread([&ret, this]() {
             try
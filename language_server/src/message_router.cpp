@@ -14,39 +14,68 @@
 
 #include "message_router.h"
 
-hlasm_plugin::language_server::message_router::message_router(json_sink* optional_default_route)
+#include <algorithm>
+
+#include "nlohmann/json.hpp"
+
+namespace hlasm_plugin::language_server {
+
+message_router::message_router(json_sink* optional_default_route)
     : default_route(optional_default_route)
 {}
 
-void hlasm_plugin::language_server::message_router::register_route(message_predicate predicate, json_sink& sink)
+void message_router::register_route(message_predicate predicate, json_sink& sink)
 {
     routes.emplace_back(std::move(predicate), &sink);
 }
 
-void hlasm_plugin::language_server::message_router::write(const nlohmann::json& msg)
+void message_router::register_method_route(std::string method, json_sink& sink)
 {
-    for (const auto& [filter, target] : routes)
-    {
-        if (filter(msg))
-        {
-            target->write(msg);
-            return;
-        }
-    }
-    if (default_route)
-        default_route->write(msg);
+    auto it = std::ranges::lower_bound(method_routes, method, {}, &std::pair<std::string, json_sink*>::first);
+    method_routes.emplace(it, std::move(method), &sink);
 }
 
-void hlasm_plugin::language_server::message_router::write(nlohmann::json&& msg)
+void message_router::register_method_prefix_route(std::string prefix, json_sink& sink)
 {
-    for (const auto& [filter, target] : routes)
+    method_prefix_routes.emplace_back(std::move(prefix), &sink);
+}
+
+json_sink* message_router::find_route(const nlohmann::json& msg) const
+{
+    if ((!method_routes.empty() || !method_prefix_routes.empty()) && msg.is_object())
     {
-        if (filter(msg))
+        if (auto method_it = msg.find("method"); method_it != msg.end() && method_it->is_string())
         {
-            target->write(std::move(msg));
-            return;
+            const std::string_view method = method_it->get_ref<const std::string&>();
+
+            auto it = std::ranges::lower_bound(
+                method_routes, method, {}, [](const auto& r) { return std::string_view(r.first); });
+            if (it != method_routes.end() && it->first == method)
+                return it->second;
+
+            for (const auto& [prefix, target] : method_prefix_routes)
+                if (method.starts_with(prefix))
+                    return target;
         }
     }
-    if (default_route)
-        default_route->write(std::move(msg));
+
+    for (const auto& [filter, target] : routes)
+        if (filter(msg))
+            return target;
+
+    return default_route;
 }
+
+void message_router::write(const nlohmann::json& msg)
+{
+    if (auto* target = find_route(msg))
+        target->write(msg);
+}
+
+void message_router::write(nlohmann::json&& msg)
+{
+    if (auto* target = find_route(msg))
+        target->write(std::move(msg));
+}
+
+} // namespace hlasm_plugin::language_server
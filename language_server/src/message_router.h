@@ -16,24 +16,35 @@
 #define HLASMPLUGIN_HLASMLANGUAGESERVER_MESSAGE_ROUTER_H
 
 #include <functional>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include "json_channel.h"
 
 namespace hlasm_plugin::language_server {
+// Routes messages selected by their method name first (exact match, then prefix match), then by the predicates in
+// the order of registration. The method name is extracted only once per message.
 class message_router final : public json_sink
 {
 public:
     using message_predicate = std::function<bool(const nlohmann::json&)>;
 
 private:
+    // sorted by the method name
+    std::vector<std::pair<std::string, json_sink*>> method_routes;
+    std::vector<std::pair<std::string, json_sink*>> method_prefix_routes;
     std::vector<std::pair<message_predicate, json_sink*>> routes;
     json_sink* default_route;
 
+    json_sink* find_route(const nlohmann::json& msg) const;
+
 public:
     explicit message_router(json_sink* optional_default_route = nullptr);
     void register_route(message_predicate predicate, json_sink& sink);
+    void register_method_route(std::string method, json_sink& sink);
+    void register_method_prefix_route(std::string prefix, json_sink& sink);
 
     void write(const nlohmann::json&) override;
     void write(nlohmann::json&&) override;
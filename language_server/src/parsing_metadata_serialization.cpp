@@ -41,6 +41,8 @@ void to_json(nlohmann::json& j, const parser_library::performance_metrics& metri
         { "Continued Statements", metrics.continued_statements },
         { "Non-continued Statements", metrics.non_continued_statements },
         { "Lines", metrics.lines },
+        { "Opcode Cache Hit Rate", metrics.opcode_cache_hit_rate() },
+        { "Mach Evaluation Cache Hit Rate", metrics.mach_evaluation_cache_hit_rate() },
     };
 }
 
@@ -49,6 +51,7 @@ void to_json(nlohmann::json& j, const parser_library::parsing_metadata& metadata
     j = nlohmann::json { { "properties", metadata.ws_info }, { "measurements", metadata.metrics } };
     j["measurements"]["error_count"] = metadata.errors;
     j["measurements"]["warning_count"] = metadata.warnings;
+    j["measurements"]["longest_slice"] = metadata.longest_slice;
 }
 
 } // namespace hlasm_plugin::parser_library
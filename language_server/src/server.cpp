@@ -35,11 +35,11 @@ void server::register_feature_methods()
     }
 }
 
-void server::call_method(const std::string& method, std::optional<request_id> id, const nlohmann::json& args)
+void server::call_method(std::string_view method, std::optional<request_id> id, const nlohmann::json& args)
 {
     if (shutdown_request_received_)
     {
-        LOG_WARNING("Request " + method + " was received after shutdown request.");
+        LOG_WARNING("Request " + std::string(method) + " was received after shutdown request.");
     }
 
     auto found = methods_.find(method);
@@ -47,7 +47,7 @@ void server::call_method(const std::string& method, std::optional<request_id> id
     {
         if (found->second.is_request_handler() && !id)
         {
-            LOG_WARNING("Missing request id for method:" + method);
+            LOG_WARNING("Missing request id for method:" + std::string(method));
             send_telemetry_error("call_method/missing_id");
             return;
         }
@@ -95,7 +95,7 @@ void server::call_method(const std::string& method, std::optional<request_id> id
         ss << "Method " << method << " is not available on this server.";
         LOG_WARNING(ss.str());
 
-        send_telemetry_error("method_not_implemented", method);
+        send_telemetry_error("method_not_implemented", std::string(method));
     }
 }
 
@@ -18,6 +18,7 @@
 #include <chrono>
 #include <map>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -53,7 +54,7 @@ protected:
 
     std::vector<std::unique_ptr<feature>> features_;
 
-    std::map<std::string, method> methods_;
+    std::map<std::string, method, std::less<>> methods_;
     std::unordered_map<request_id,
         std::pair<std::function<void(const nlohmann::json& params)>, std::function<void(int, const char*)>>>
         request_handlers_;
@@ -75,7 +76,7 @@ protected:
     void register_feature_methods();
 
     // Calls a method that is registered in methods_ with the specified name with arguments and id of request.
-    void call_method(const std::string& method, std::optional<request_id> id, const nlohmann::json& args);
+    void call_method(std::string_view method, std::optional<request_id> id, const nlohmann::json& args);
 
     void send_telemetry_error(std::string where, std::string what = "");
 
@@ -18,16 +18,6 @@
 #include "nlohmann/json.hpp"
 #include "workspace_manager.h"
 
-namespace {
-std::string_view extract_method(const nlohmann::json& msg)
-{
-    auto method_it = msg.find("method");
-    if (method_it == msg.end() || !method_it->is_string())
-        return {};
-    return method_it->get<std::string_view>();
-}
-} // namespace
-
 namespace hlasm_plugin::language_server {
 
 void virtual_file_provider::write(const nlohmann::json& m)
@@ -64,9 +54,4 @@ void virtual_file_provider::write(const nlohmann::json& m)
 }
 void virtual_file_provider::write(nlohmann::json&& m) { write(m); }
 
-message_router::message_predicate virtual_file_provider::get_filtering_predicate() const
-{
-    return [](const nlohmann::json& msg) { return extract_method(msg) == "get_virtual_file_content"; };
-}
-
 } // namespace hlasm_plugin::language_server
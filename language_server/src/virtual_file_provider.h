@@ -16,9 +16,10 @@
 #ifndef HLASMPLUGIN_LANGUAGESERVER_VIRTUAL_FILE_PROVIDER_H
 #define HLASMPLUGIN_LANGUAGESERVER_VIRTUAL_FILE_PROVIDER_H
 
-#include "json_channel.h"
+#include <string>
+#include <string_view>
 
-#include "message_router.h"
+#include "json_channel.h"
 
 namespace hlasm_plugin::parser_library {
 class workspace_manager;
@@ -41,7 +42,10 @@ public:
         , out_stream(&out)
     {}
 
-    [[nodiscard]] message_router::message_predicate get_filtering_predicate() const;
+    static constexpr std::string_view message_method = "get_virtual_file_content";
+
+    // the method name the provider expects to be routed to it
+    [[nodiscard]] std::string get_route_method() const { return std::string(message_method); }
 };
 
 } // namespace hlasm_plugin::language_server
@@ -159,7 +159,7 @@ struct feature_launch_test : public testing::Test
         resp_provider.exited = false;
     }
 
-    std::map<std::string, method> methods;
+    std::map<std::string, method, std::less<>> methods;
     response_provider_mock resp_provider;
     std::unique_ptr<parser_library::workspace_manager> ws_mngr = parser_library::create_workspace_manager();
     dap::dap_feature feature;
@@ -19,6 +19,7 @@
 #include "../ws_mngr_mock.h"
 #include "dap/dap_session.h"
 #include "dap/dap_session_manager.h"
+#include "message_router.h"
 #include "nlohmann/json.hpp"
 #include "workspace_manager.h"
 
@@ -78,11 +79,14 @@ TEST(dap_sessions, session_manager)
     stream_json_sink session_out;
     dap::session_manager sess_mgr(mock_dc, session_out);
 
-    auto session_manager_matcher = sess_mgr.get_filtering_predicate();
-    EXPECT_TRUE(session_manager_matcher(nlohmann::json { { "method", "hlasm/dap_tunnel" } }));
-    EXPECT_TRUE(session_manager_matcher(nlohmann::json { { "method", "hlasm/dap_tunnel/0" } }));
+    stream_json_sink other;
+    message_router router(&other);
+    router.register_method_prefix_route(sess_mgr.get_route_prefix(), sess_mgr);
 
-    sess_mgr.write(nlohmann::json { { "method", "hlasm/dap_tunnel" }, { "params", { { "session_id", 1 } } } });
+    router.write(nlohmann::json { { "method", "hlasm/dap_tunnel" }, { "params", { { "session_id", 1 } } } });
+    router.write(nlohmann::json { { "method", "hlasm/dap_tunnel/0" } });
+    router.write(nlohmann::json { { "method", "hlasm/dap" }, { "params", { { "session_id", 2 } } } });
 
     EXPECT_EQ(sess_mgr.registered_sessions_count(), 1);
+    EXPECT_EQ(other.take_output(), R"({"method":"hlasm/dap","params":{"session_id":2}})");
 }
@@ -18,22 +18,30 @@
 
 #include "../../parser_library/test/workspace_manager_response_mock.h"
 #include "external_file_reader.h"
+#include "message_router.h"
 #include "nlohmann/json.hpp"
 
 using namespace ::testing;
 using namespace hlasm_plugin::language_server;
 using namespace hlasm_plugin::parser_library;
 
-TEST(external_file_reader, filter_predicate)
+TEST(external_file_reader, route)
 {
     NiceMock<mock_json_sink> sink;
     external_file_reader reader(sink);
 
-    auto predicate = reader.get_filtering_predicate();
+    mock_json_sink target;
+    mock_json_sink other;
+    message_router router(&other);
+    router.register_method_route(reader.get_route_method(), target);
 
-    EXPECT_TRUE(predicate(R"({"method":"external_file_response"})"_json));
-    EXPECT_FALSE(predicate(R"({"method":"external_file_response1"})"_json));
-    EXPECT_FALSE(predicate(R"({"method":"external_file_request"})"_json));
+    EXPECT_CALL(target, write_rvr(R"({"method":"external_file_response"})"_json));
+    EXPECT_CALL(other, write_rvr(R"({"method":"external_file_response1"})"_json));
+    EXPECT_CALL(other, write_rvr(R"({"method":"external_file_request"})"_json));
+
+    router.write(R"({"method":"external_file_response"})"_json);
+    router.write(R"({"method":"external_file_response1"})"_json);
+    router.write(R"({"method":"external_file_request"})"_json);
 }
 
 TEST(external_file_reader, file_reading)
@@ -35,7 +35,7 @@ TEST(language_features, completion)
     test::ws_mngr_mock ws_mngr;
     NiceMock<response_provider_mock> response_mock;
     lsp::feature_language_features f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(
@@ -52,7 +52,7 @@ TEST(language_features, completion_resolve)
     test::ws_mngr_mock ws_mngr;
     NiceMock<response_provider_mock> response_mock;
     lsp::feature_language_features f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(
@@ -85,7 +85,7 @@ TEST(language_features, completion_resolve_invalid)
     test::ws_mngr_mock ws_mngr;
     NiceMock<response_provider_mock> response_mock;
     lsp::feature_language_features f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     nlohmann::json completion_resolve_response;
@@ -100,7 +100,7 @@ TEST(language_features, hover)
     test::ws_mngr_mock ws_mngr;
     NiceMock<response_provider_mock> response_mock;
     lsp::feature_language_features f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(
@@ -117,7 +117,7 @@ TEST(language_features, definition)
 
     NiceMock<response_provider_mock> response_mock;
     lsp::feature_language_features f(*ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(
@@ -134,7 +134,7 @@ TEST(language_features, references)
     test::ws_mngr_mock ws_mngr;
     NiceMock<response_provider_mock> response_mock;
     lsp::feature_language_features f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(
@@ -149,7 +149,7 @@ TEST(language_features, document_symbol)
     auto ws_mngr = parser_library::create_workspace_manager();
     response_provider_mock response_mock;
     lsp::feature_language_features f(*ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     std::string file_text = "A EQU 1";
@@ -178,7 +178,7 @@ TEST(language_features, semantic_tokens)
     auto ws_mngr = parser_library::create_workspace_manager();
     response_provider_mock response_mock;
     lsp::feature_language_features f(*ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     std::string file_text = "A EQU 1\n SAM31";
@@ -199,7 +199,7 @@ TEST(language_features, semantic_tokens_cancelled)
     auto ws_mngr = parser_library::create_workspace_manager();
     response_provider_mock response_mock;
     lsp::feature_language_features f(*ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     std::string file_text = "A EQU 1\n SAM31";
@@ -226,7 +226,7 @@ TEST(language_features, semantic_tokens_multiline)
     auto ws_mngr = parser_library::create_workspace_manager();
     response_provider_mock response_mock;
     lsp::feature_language_features f(*ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     std::string file_text = R"(
@@ -260,7 +260,7 @@ TEST(language_features, semantic_tokens_multiline_overlap)
     auto ws_mngr = parser_library::create_workspace_manager();
     response_provider_mock response_mock;
     lsp::feature_language_features f(*ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     std::string file_text = R"(
@@ -403,7 +403,7 @@ TEST(language_features, opcode_suggestion)
     auto ws_mngr = parser_library::create_workspace_manager();
     NiceMock<response_provider_mock> response_mock;
     lsp::feature_language_features f(*ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 =
@@ -423,7 +423,7 @@ TEST(language_features, branch_information)
     test::ws_mngr_mock ws_mngr;
     NiceMock<response_provider_mock> response_mock;
     lsp::feature_language_features f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + uri + R"("}})");
@@ -473,7 +473,7 @@ TEST(language_features, folding)
     auto ws_mngr = parser_library::create_workspace_manager();
     response_provider_mock response_mock;
     lsp::feature_language_features f(*ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     std::string file_text = "*\n*\n*\n";
@@ -37,7 +37,7 @@ TEST(text_synchronization, did_open_file)
     test::ws_mngr_mock ws_mngr;
     response_provider_mock response_mock;
     lsp::feature_text_synchronization f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(
@@ -68,7 +68,7 @@ TEST(text_synchronization, did_change_file)
     test::ws_mngr_mock ws_mngr;
     response_provider_mock response_mock;
     lsp::feature_text_synchronization f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + txt_file_uri
@@ -106,7 +106,7 @@ TEST(text_synchronization, did_close_file)
     test::ws_mngr_mock ws_mngr;
     response_provider_mock response_mock;
     lsp::feature_text_synchronization f(ws_mngr, response_mock);
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     auto params1 = nlohmann::json::parse(R"({"textDocument":{"uri":")" + txt_file_uri + R"("}})");
@@ -41,7 +41,7 @@ TEST(workspace_folders, did_change_workspace_folders)
 
     lsp::feature_workspace_folders f(ws_mngr, rpm);
 
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
     f.register_methods(notifs);
 
     EXPECT_CALL(ws_mngr, add_workspace(::testing::StrEq("OneDrive"), ::testing::StrEq(ws1_uri)));
@@ -73,7 +73,7 @@ TEST(workspace_folders, did_change_watchedfiles_invalid_uri)
     response_provider_mock rpm;
     lsp::feature_workspace_folders f(ws_mngr, rpm);
 
-    std::map<std::string, method> notifs;
+    std::map<std::string, method, std::less<>> notifs;
 
     f.register_methods(notifs);
     notifs["workspace/didChangeWatchedFiles"].as_notification_handler()(
@@ -186,7 +186,7 @@ TEST(workspace_folders, did_change_configuration)
     feature_workspace_folders feat(ws_mngr, provider);
 
 
-    std::map<std::string, method> methods;
+    std::map<std::string, method, std::less<>> methods;
     feat.register_methods(methods);
 
 
@@ -241,7 +241,7 @@ TEST(workspace_folders, did_change_configuration_empty_configuration_params)
     feature_workspace_folders feat(ws_mngr, provider);
 
 
-    std::map<std::string, method> methods;
+    std::map<std::string, method, std::less<>> methods;
     feat.register_methods(methods);
 
 
@@ -98,3 +98,38 @@ TEST(message_router, without_default)
     EXPECT_EQ(results[2], router1_msg);
     EXPECT_EQ(results[3], default_msg);
 }
+
+TEST(message_router, method_routes)
+{
+    using namespace ::testing;
+
+    mock_json_sink exact;
+    mock_json_sink prefix;
+    mock_json_sink predicate;
+    mock_json_sink default_route;
+
+    message_router router(&default_route);
+    router.register_route([](const nlohmann::json&) { return true; }, predicate);
+    router.register_method_route("b_method", exact);
+    router.register_method_route("a_method", exact);
+    router.register_method_prefix_route("tunnel/", prefix);
+
+    const auto a_msg = R"({"method":"a_method"})"_json;
+    const auto b_msg = R"({"method":"b_method"})"_json;
+    const auto tunnel_msg = R"({"method":"tunnel/1"})"_json;
+    const auto other_msg = R"({"method":"c_method"})"_json;
+    const auto no_method_msg = R"("no_method")"_json;
+
+    EXPECT_CALL(exact, write(a_msg));
+    EXPECT_CALL(exact, write(b_msg));
+    EXPECT_CALL(prefix, write(tunnel_msg));
+    EXPECT_CALL(predicate, write(other_msg));
+    EXPECT_CALL(predicate, write(no_method_msg));
+    EXPECT_CALL(default_route, write(_)).Times(0);
+
+    router.write(a_msg);
+    router.write(b_msg);
+    router.write(tunnel_msg);
+    router.write(other_msg);
+    router.write(no_method_msg);
+}
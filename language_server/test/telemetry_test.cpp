@@ -91,6 +91,8 @@ TEST(telemetry, lsp_server_did_open)
 
     EXPECT_GT(metrics["duration"], 0U);
     EXPECT_EQ(metrics["error_count"], 1);
+    EXPECT_GT(metrics["longest_slice"], 0.0);
+    EXPECT_LE(metrics["longest_slice"], metrics["duration"]);
 
     nlohmann::json& ws_info = telemetry_reply["params"]["properties"];
 
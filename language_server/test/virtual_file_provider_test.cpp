@@ -15,6 +15,7 @@
 #include "gmock/gmock.h"
 #include "json_channel.h"
 
+#include "message_router.h"
 #include "nlohmann/json.hpp"
 #include "protocol.h"
 #include "virtual_file_provider.h"
@@ -31,18 +32,25 @@ struct json_sink_mock : public json_sink
     void write(nlohmann::json&& j) override { write(j); }
 };
 
-TEST(virtual_file_provider, predicate)
+TEST(virtual_file_provider, route)
 {
     ws_mngr_mock ws_mngr;
     json_sink_mock sink;
 
     virtual_file_provider vfp(ws_mngr, sink);
-    auto pred = vfp.get_filtering_predicate();
 
-    EXPECT_TRUE(pred(nlohmann::json { { "method", "get_virtual_file_content" } }));
-    EXPECT_FALSE(pred(nlohmann::json { { "method", "get_virtual_file_content1" } }));
-    EXPECT_FALSE(pred(nlohmann::json { { "method", "get_virtual_file_conten" } }));
-    EXPECT_FALSE(pred(nlohmann::json { { "nested", { "method", "get_virtual_file_content" } } }));
+    json_sink_mock target;
+    json_sink_mock other;
+    message_router router(&other);
+    router.register_method_route(vfp.get_route_method(), target);
+
+    EXPECT_CALL(target, write(nlohmann::json { { "method", "get_virtual_file_content" } }));
+    EXPECT_CALL(other, write).Times(3);
+
+    router.write(nlohmann::json { { "method", "get_virtual_file_content" } });
+    router.write(nlohmann::json { { "method", "get_virtual_file_content1" } });
+    router.write(nlohmann::json { { "method", "get_virtual_file_conten" } });
+    router.write(nlohmann::json { { "nested", { "method", "get_virtual_file_content" } } });
 }
 
 TEST(virtual_file_provider, file_missing)
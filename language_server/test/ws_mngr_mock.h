@@ -104,6 +104,13 @@ public:
         folding,
         (const char* document_uri, workspace_manager_response<continuous_sequence<folding_range>> resp),
         (override));
+
+    MOCK_METHOD(void,
+        macro_trace,
+        (const char* document_uri,
+            macro_trace_format format,
+            workspace_manager_response<continuous_sequence<char>> resp),
+        (override));
 };
 
 } // namespace hlasm_plugin::language_server::test
@@ -17,6 +17,7 @@
 #include <cassert>
 #include <charconv>
 #include <cstring>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -32,6 +33,7 @@
 #include "preprocessor_options.h"
 #include "utils/resource_location.h"
 #include "utils/unicode_text.h"
+#include "workspaces/file.h"
 #include "workspaces/parse_lib_provider.h"
 
 using namespace hlasm_plugin::utils;
@@ -80,14 +82,16 @@ public:
         return true;
     }
 
-    [[nodiscard]] value_task<std::optional<std::pair<std::string, resource::resource_location>>> get_library(
-        std::string library) override
+    [[nodiscard]] value_task<
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>>
+    get_library(std::string library) override
     {
         auto lib = read_library_name(library);
         if (!lib.has_value())
             co_return std::nullopt;
 
-        co_return std::pair<std::string, resource_location>(files[lib.value()], resource_location(std::move(library)));
+        co_return std::make_pair(
+            workspaces::make_text_buffer(files[lib.value()]), resource_location(std::move(library)));
     }
 
     std::vector<std::string> files;
@@ -102,7 +102,8 @@ public:
     // Retrieval of current context.
     stack_frames_t stack_frames() const;
     scopes_t scopes(frame_id_t frame_id) const;
-    variables_t variables(var_reference_t var_ref) const;
+    // returns count variables starting at start, zero count returns all of them
+    variables_t variables(var_reference_t var_ref, size_t start = 0, size_t count = 0) const;
 
     void analysis_step(const std::atomic<unsigned char>* yield_indicator);
 };
@@ -41,6 +41,10 @@ public:
     [[nodiscard]] lib_config fill_missing_settings(const lib_config& second) const;
 
     std::optional<int64_t> diag_supress_limit;
+    // number of macro entry/exit events kept per opened program, 0 disables the macro trace
+    std::optional<int64_t> macro_trace_events;
+    // publish syntax errors from a quick library-less pass before the first full analysis of an opened file
+    std::optional<bool> fast_syntax_diagnostics;
 
 private:
     // Returns an instance that has missing settings of this filled with not missing setting of the parameter
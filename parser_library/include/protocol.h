@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
 
 #include "parser_library_export.h"
 #include "range.h"
@@ -70,7 +71,6 @@ struct stack_frame;
 struct source;
 struct scope;
 class variable;
-struct variable_store;
 } // namespace debugging
 
 namespace lsp {
@@ -279,10 +279,32 @@ struct PARSER_LIBRARY_EXPORT performance_metrics
     size_t lookahead_statements = 0;
     size_t continued_statements = 0;
     size_t non_continued_statements = 0;
+    size_t opcode_cache_hits = 0;
+    size_t opcode_cache_misses = 0;
+    size_t mach_evaluation_cache_hits = 0;
+    size_t mach_evaluation_cache_misses = 0;
+
+    double opcode_cache_hit_rate() const noexcept
+    {
+        const auto lookups = opcode_cache_hits + opcode_cache_misses;
+        return lookups ? (double)opcode_cache_hits / (double)lookups : 0.;
+    }
+
+    double mach_evaluation_cache_hit_rate() const noexcept
+    {
+        const auto lookups = mach_evaluation_cache_hits + mach_evaluation_cache_misses;
+        return lookups ? (double)mach_evaluation_cache_hits / (double)lookups : 0.;
+    }
 
     bool operator==(const performance_metrics&) const noexcept = default;
 };
 
+enum class PARSER_LIBRARY_EXPORT macro_trace_format
+{
+    chrome_trace,
+    folded_stacks,
+};
+
 struct PARSER_LIBRARY_EXPORT workspace_file_info
 {
     size_t files_processed = 0;
@@ -297,6 +319,8 @@ struct PARSER_LIBRARY_EXPORT parsing_metadata
     workspace_file_info ws_info;
     size_t errors = 0;
     size_t warnings = 0;
+    // longest uninterrupted run of the analysis in seconds
+    double longest_slice = 0;
 };
 
 struct PARSER_LIBRARY_EXPORT diagnostic_list
@@ -382,6 +406,7 @@ struct PARSER_LIBRARY_EXPORT scope
     sequence<char> name;
     var_reference_t variable_reference;
     source source_file;
+    size_t named_variables;
 };
 
 using scopes_t = sequence<scope, const debugging::scope*>;
@@ -396,7 +421,7 @@ struct PARSER_LIBRARY_EXPORT variable
     set_type type;
 };
 
-using variables_t = sequence<variable, const debugging::variable_store*>;
+using variables_t = sequence<variable, const std::unique_ptr<debugging::variable>*>;
 
 struct breakpoint
 {
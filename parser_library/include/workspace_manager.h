@@ -153,6 +153,10 @@ public:
 
     virtual void folding(
         const char* document_uri, workspace_manager_response<continuous_sequence<folding_range>> resp) = 0;
+
+    virtual void macro_trace(const char* document_uri,
+        macro_trace_format format,
+        workspace_manager_response<continuous_sequence<char>> resp) = 0;
 };
 
 workspace_manager* create_workspace_manager_impl(
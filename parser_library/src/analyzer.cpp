@@ -131,7 +131,8 @@ struct analyzer::impl
               text,
               opts.get_lib_provider(),
               field_parser,
-              std::move(opts.fade_messages))
+              std::move(opts.fade_messages),
+              opts.syntax_only == syntax_check_only::yes)
     {}
 
     analyzing_context ctx;
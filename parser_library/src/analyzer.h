@@ -69,6 +69,13 @@ enum class file_is_opencode : bool
     yes,
 };
 
+// parse the statements without processing macros, copy members or conditional assembly
+enum class syntax_check_only : bool
+{
+    no,
+    yes,
+};
+
 class analyzer_options
 {
     utils::resource::resource_location file_loc = utils::resource::resource_location("");
@@ -77,6 +84,7 @@ class analyzer_options
     workspaces::library_data library_data = { processing::processing_kind::ORDINARY, context::id_index() };
     collect_highlighting_info collect_hl_info = collect_highlighting_info::no;
     file_is_opencode parsing_opencode = file_is_opencode::no;
+    syntax_check_only syntax_only = syntax_check_only::no;
     std::shared_ptr<context::id_storage> ids_init;
     std::vector<preprocessor_options> preprocessor_args;
     virtual_file_monitor* vf_monitor = nullptr;
@@ -89,6 +97,7 @@ class analyzer_options
     void set(workspaces::library_data ld) { library_data = std::move(ld); }
     void set(collect_highlighting_info hi) { collect_hl_info = hi; }
     void set(file_is_opencode f_oc) { parsing_opencode = f_oc; }
+    void set(syntax_check_only so) { syntax_only = so; }
     void set(std::shared_ptr<context::id_storage> ids) { ids_init = std::move(ids); }
     void set(preprocessor_options pp) { preprocessor_args.push_back(std::move(pp)); }
     void set(std::vector<preprocessor_options> pp) { preprocessor_args = std::move(pp); }
@@ -118,14 +127,15 @@ public:
         constexpr auto lib_data_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, workspaces::library_data>);
         constexpr auto hi_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, collect_highlighting_info>);
         constexpr auto f_oc_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, file_is_opencode>);
+        constexpr auto so_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, syntax_check_only>);
         constexpr auto ids_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, std::shared_ptr<context::id_storage>>);
         constexpr auto pp_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, preprocessor_options>)+(
             0 + ... + std::is_same_v<std::decay_t<Args>, std::vector<preprocessor_options>>);
         constexpr auto vfm_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, virtual_file_monitor*>);
         constexpr auto fmc_cnt =
             (0 + ... + std::is_same_v<std::decay_t<Args>, std::shared_ptr<std::vector<fade_message_s>>>);
-        constexpr auto cnt = rl_cnt + lib_cnt + ao_cnt + ac_cnt + lib_data_cnt + hi_cnt + f_oc_cnt + ids_cnt + pp_cnt
-            + vfm_cnt + fmc_cnt;
+        constexpr auto cnt = rl_cnt + lib_cnt + ao_cnt + ac_cnt + lib_data_cnt + hi_cnt + f_oc_cnt + so_cnt + ids_cnt
+            + pp_cnt + vfm_cnt + fmc_cnt;
 
         static_assert(rl_cnt <= 1, "Duplicate resource_location");
         static_assert(lib_cnt <= 1, "Duplicate parse_lib_provider");
@@ -134,6 +144,7 @@ public:
         static_assert(lib_data_cnt <= 1, "Duplicate library_data");
         static_assert(hi_cnt <= 1, "Duplicate collect_highlighting_info");
         static_assert(f_oc_cnt <= 1, "Duplicate file_is_opencode");
+        static_assert(so_cnt <= 1, "Duplicate syntax_check_only");
         static_assert(ids_cnt <= 1, "Duplicate id_storage");
         static_assert(pp_cnt <= 1, "Duplicate preprocessor_args");
         static_assert(vfm_cnt <= 1, "Duplicate virtual_file_monitor");
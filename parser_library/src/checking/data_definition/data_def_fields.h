@@ -15,6 +15,9 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_CHECKING_DATA_DEF_FIELDS_H
 #define HLASMPLUGIN_PARSERLIBRARY_CHECKING_DATA_DEF_FIELDS_H
 
+#include <cstdint>
+#include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -95,7 +98,8 @@ struct data_def_address
 using expr_or_address = std::variant<data_def_expr, data_def_address>;
 using nominal_value_expressions = std::vector<expr_or_address>;
 using nominal_value_t = data_def_field<std::variant<std::string, nominal_value_expressions>>;
-using reduced_nominal_value_t = data_def_field<std::variant<std::string, size_t>>;
+// Views the nominal value it was reduced from, does not own any data
+using reduced_nominal_value_t = data_def_field<std::variant<std::string_view, size_t>>;
 using scale_modifier_t = data_def_field<int16_t>;
 using exponent_modifier_t = data_def_field<int32_t>;
 using dupl_factor_modifier_t = data_def_field<int32_t>;
@@ -106,25 +110,30 @@ inline T round_up(T n, T m)
     return ((n + m - 1) / m) * m;
 }
 
+// Parts of the operand length that depend only on the nominal value
+struct nominal_length_summary
+{
+    bool present = false;
+    uint64_t values = 0;
+    // implicit length in bytes, only for types whose length depends on the nominal value
+    uint64_t nominal_length = 0;
+};
+
 inline reduced_nominal_value_t reduce_nominal_value(const nominal_value_t& n)
 {
     struct
     {
-        std::variant<std::string, size_t> operator()(const std::string& s) const { return s; }
-        std::variant<std::string, size_t> operator()(const nominal_value_expressions& e) const { return e.size(); }
+        std::variant<std::string_view, size_t> operator()(const std::string& s) const { return s; }
+        std::variant<std::string_view, size_t> operator()(const nominal_value_expressions& e) const
+        {
+            return e.size();
+        }
     } visitor;
     return reduced_nominal_value_t(n.present, std::visit(visitor, n.value), n.rng);
 }
 
-inline reduced_nominal_value_t reduce_nominal_value(nominal_value_t&& n)
-{
-    struct
-    {
-        std::variant<std::string, size_t> operator()(std::string&& s) const { return std::move(s); }
-        std::variant<std::string, size_t> operator()(nominal_value_expressions&& e) const { return e.size(); }
-    } visitor;
-    return reduced_nominal_value_t(n.present, std::visit(visitor, std::move(n.value)), n.rng);
-}
+// the reduced value would refer to the temporary
+reduced_nominal_value_t reduce_nominal_value(nominal_value_t&& n) = delete;
 
 } // namespace hlasm_plugin::parser_library::checking
 
@@ -14,6 +14,7 @@
 
 #include "data_def_type_base.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "checking/diagnostic_collector.h"
@@ -305,7 +306,7 @@ bool data_def_type::check_nominal_type(
             for (auto& p : std::get<nominal_value_expressions>(op.nominal_value.value))
                 if (std::holds_alternative<data_def_address>(p))
                 {
-                    auto adr = std::get<data_def_address>(p);
+                    const auto& adr = std::get<data_def_address>(p);
                     add_diagnostic(
                         diagnostic_op::error_D020({ adr.displacement.rng.start, adr.base.rng.end }, type_str));
                     ret = false;
@@ -376,10 +377,10 @@ size_t data_def_type::get_number_of_values_in_nominal(const reduced_nominal_valu
 {
     if (type == 'C' || type == 'G') // C and G do not support multiple nominal values
         return 1;
-    else if (std::holds_alternative<std::string>(nom.value))
+    else if (std::holds_alternative<std::string_view>(nom.value))
     {
-        const std::string& s = std::get<std::string>(nom.value);
-        return std::count(s.begin(), s.end(), ',') + 1;
+        const std::string_view s = std::get<std::string_view>(nom.value);
+        return std::ranges::count(s, ',') + 1;
     }
     else
         return std::get<size_t>(nom.value);
@@ -393,30 +394,42 @@ uint64_t data_def_type::get_length(const data_definition_operand& op) const
 uint64_t data_def_type::get_length(const data_def_field<int32_t>& dupl_factor,
     const data_def_length_t& length,
     const reduced_nominal_value_t& rnv) const
+{
+    return get_length(dupl_factor, length, summarize_nominal(rnv));
+}
+uint64_t data_def_type::get_length(const data_def_field<int32_t>& dupl_factor,
+    const data_def_length_t& length,
+    const nominal_length_summary& nominal) const
 {
     uint64_t len_in_bits;
     if (length.present)
     {
-        uint64_t val_count = get_number_of_values_in_nominal(rnv);
-        len_in_bits = val_count * length.value;
+        len_in_bits = nominal.values * length.value;
 
         if (length.len_type == data_def_length_t::BYTE)
             len_in_bits *= 8;
     }
     else if (std::holds_alternative<as_needed>(implicit_length_))
-        len_in_bits = get_nominal_length(rnv) * 8;
-    else if (!rnv.present)
+        len_in_bits = nominal.nominal_length * 8;
+    else if (!nominal.present)
         len_in_bits = std::get<uint64_t>(implicit_length_) * 8;
     else
-    {
-        uint64_t val_count = get_number_of_values_in_nominal(rnv);
-        len_in_bits = val_count * std::get<uint64_t>(implicit_length_) * 8;
-    }
+        len_in_bits = nominal.values * std::get<uint64_t>(implicit_length_) * 8;
     if (dupl_factor.present)
         len_in_bits *= (uint64_t)dupl_factor.value;
     return len_in_bits;
 }
 
+nominal_length_summary data_def_type::summarize_nominal(const reduced_nominal_value_t& rnv) const
+{
+    nominal_length_summary result;
+    result.present = rnv.present;
+    result.values = get_number_of_values_in_nominal(rnv);
+    if (std::holds_alternative<as_needed>(implicit_length_))
+        result.nominal_length = get_nominal_length(rnv);
+    return result;
+}
+
 uint32_t data_def_type::get_length_attribute(
     const data_def_length_t& length, const reduced_nominal_value_t& nominal) const
 {
@@ -121,6 +121,11 @@ public:
     uint64_t get_length(const data_def_field<int32_t>& dupl_factor,
         const data_def_length_t& length,
         const reduced_nominal_value_t& rnv) const;
+    uint64_t get_length(const data_def_field<int32_t>& dupl_factor,
+        const data_def_length_t& length,
+        const nominal_length_summary& nominal) const;
+    // computes the length information that does not depend on modifiers, so that it can be reused
+    nominal_length_summary summarize_nominal(const reduced_nominal_value_t& rnv) const;
     // returns the length attribute of operand with specified length modifier and nominal value
     uint32_t get_length_attribute(const data_def_length_t& length, const reduced_nominal_value_t& nominal) const;
     // returns scale attribute of operand with specified scale modifier and nominal value
@@ -48,7 +48,7 @@ bool check_A_AD_Y_length(const std::string& type,
     if (!op.length.present)
         return true;
 
-    for (auto e : std::get<nominal_value_expressions>(op.nominal_value.value))
+    for (const auto& e : std::get<nominal_value_expressions>(op.nominal_value.value))
     {
         const data_def_expr& expr = std::get<data_def_expr>(e);
         if (!expr.ignored && expr.ex_kind != expr_type::ABS)
@@ -169,13 +169,13 @@ bool data_def_type_P_Z::check(
 
 int16_t data_def_type_P_Z::get_implicit_scale(const reduced_nominal_value_t& op) const
 {
-    if (!op.present || !std::holds_alternative<std::string>(op.value))
+    if (!op.present || !std::holds_alternative<std::string_view>(op.value))
         return 0;
     // Count number of characters between the first . and first ,
 
     uint16_t count = 0;
     bool do_count = false;
-    for (char c : std::get<std::string>(op.value))
+    for (char c : std::get<std::string_view>(op.value))
     {
         if (c == ',')
             break;
@@ -194,10 +194,10 @@ data_def_type_P::data_def_type_P()
 
 uint64_t data_def_type_P::get_nominal_length(const reduced_nominal_value_t& op) const
 {
-    if (!op.present || !std::holds_alternative<std::string>(op.value))
+    if (!op.present || !std::holds_alternative<std::string_view>(op.value))
         return 1;
 
-    const std::string& s = std::get<std::string>(op.value);
+    const std::string_view s = std::get<std::string_view>(op.value);
 
     uint64_t bytes_count = 0;
     // 4 sign bits are added to each assembled number
@@ -221,10 +221,10 @@ uint64_t data_def_type_P::get_nominal_length(const reduced_nominal_value_t& op)
 uint32_t hlasm_plugin::parser_library::checking::data_def_type_P::get_nominal_length_attribute(
     const reduced_nominal_value_t& op) const
 {
-    if (!op.present || !std::holds_alternative<std::string>(op.value))
+    if (!op.present || !std::holds_alternative<std::string_view>(op.value))
         return 1;
 
-    const std::string& s = std::get<std::string>(op.value);
+    const std::string_view s = std::get<std::string_view>(op.value);
 
     // 4 sign bits are added to each assembled number
     uint32_t halfbytes_count = 1;
@@ -251,10 +251,10 @@ data_def_type_Z::data_def_type_Z()
 
 uint64_t data_def_type_Z::get_nominal_length(const reduced_nominal_value_t& op) const
 {
-    if (!op.present || !std::holds_alternative<std::string>(op.value))
+    if (!op.present || !std::holds_alternative<std::string_view>(op.value))
         return 1;
 
-    const std::string& s = std::get<std::string>(op.value);
+    const std::string_view s = std::get<std::string_view>(op.value);
 
     // each digit is assembled as one byte
 
@@ -263,11 +263,11 @@ uint64_t data_def_type_Z::get_nominal_length(const reduced_nominal_value_t& op)
 
 uint32_t data_def_type_Z::get_nominal_length_attribute(const reduced_nominal_value_t& op) const
 {
-    if (!op.present || !std::holds_alternative<std::string>(op.value))
+    if (!op.present || !std::holds_alternative<std::string_view>(op.value))
         return 1;
 
     uint32_t first_value_len = 0;
-    for (char c : std::get<std::string>(op.value))
+    for (char c : std::get<std::string_view>(op.value))
     {
         if (c == ',')
             break;
@@ -14,9 +14,13 @@
 
 #include "hlasm_context.h"
 
+#include <chrono>
 #include <ctime>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <optional>
 
 #include "ebcdic_encoding.h"
 #include "expressions/conditional_assembly/terms/ca_constant.h"
@@ -24,6 +28,7 @@
 #include "instruction.h"
 #include "lexing/lexer.h"
 #include "lexing/tools.h"
+#include "macro_trace.h"
 #include "ordinary_assembly/location_counter.h"
 #include "using.h"
 #include "utils/time.h"
@@ -37,25 +42,34 @@ code_scope* hlasm_context::curr_scope() { return &scope_stack_.back(); }
 
 const code_scope* hlasm_context::curr_scope() const { return &scope_stack_.back(); }
 
-void hlasm_context::init_instruction_map(opcode_map& opcodes, id_storage& ids, instruction_set_version active_instr_set)
+namespace {
+std::shared_ptr<const std::unordered_map<id_index, opcode_t>> build_instruction_map(
+    instruction_set_version active_instr_set)
 {
+    auto result = std::make_shared<std::unordered_map<id_index, opcode_t>>();
+    auto& opcodes = *result;
+
+    // the maps are shared between analyses, so the ids must not depend on their id_storage
+    static id_storage ids;
+
+    // later categories take precedence
     for (const auto& instr : instruction::all_machine_instructions())
     {
         if (!instruction_available(instr.instr_set_affiliation(), active_instr_set))
             continue;
 
         auto id = ids.add(instr.name());
-        opcodes[id].emplace_back(opcode_t { id, &instr }, opcode_generation::zero);
+        opcodes[id] = opcode_t { id, &instr };
     }
     for (const auto& instr : instruction::all_assembler_instructions())
     {
         auto id = ids.add(instr.name());
-        opcodes[id].emplace_back(opcode_t { id, &instr }, opcode_generation::zero);
+        opcodes[id] = opcode_t { id, &instr };
     }
     for (const auto& instr : instruction::all_ca_instructions())
     {
         auto id = ids.add(instr.name());
-        opcodes[id].emplace_back(opcode_t { id, &instr }, opcode_generation::zero);
+        opcodes[id] = opcode_t { id, &instr };
     }
     for (const auto& instr : instruction::all_mnemonic_codes())
     {
@@ -63,8 +77,24 @@ void hlasm_context::init_instruction_map(opcode_map& opcodes, id_storage& ids, i
             continue;
 
         auto id = ids.add(instr.name());
-        opcodes[id].emplace_back(opcode_t { id, &instr }, opcode_generation::zero);
+        opcodes[id] = opcode_t { id, &instr };
     }
+
+    return result;
+}
+} // namespace
+
+std::shared_ptr<const hlasm_context::initial_opcode_map> hlasm_context::get_initial_opcodes(
+    instruction_set_version active_instr_set)
+{
+    static std::mutex mutex;
+    static std::map<instruction_set_version, std::shared_ptr<const initial_opcode_map>> maps;
+
+    std::lock_guard guard(mutex);
+    auto& result = maps[active_instr_set];
+    if (!result)
+        result = build_instruction_map(active_instr_set);
+    return result;
 }
 
 namespace {
@@ -383,7 +413,7 @@ hlasm_context::hlasm_context(
 {
     scope_stack_.emplace_back().time = utils::timestamp::now().value_or(utils::timestamp(1900, 1, 1));
 
-    init_instruction_map(opcode_mnemo_, *ids_, asm_options_.instr_set);
+    m_initial_opcodes = get_initial_opcodes(asm_options_.instr_set);
 
     add_global_system_variables(system_variables);
     add_scoped_system_variables(system_variables, 0, false);
@@ -731,29 +761,59 @@ void hlasm_context::decrement_branch_counter() { --curr_scope()->branch_counter;
 
 const opcode_t* hlasm_context::find_opcode_mnemo(id_index name, opcode_generation gen) const
 {
-    auto it = opcode_mnemo_.find(name);
-    if (it == opcode_mnemo_.end())
-        return nullptr;
-    auto op = std::find_if(it->second.rbegin(), it->second.rend(), [gen](const auto& e) { return e.second <= gen; });
-    if (op == it->second.rend())
-        return nullptr;
-    return &op->first;
+    if (gen < m_current_opcode_generation)
+        return find_opcode_mnemo_uncached(name, gen);
+
+    auto& entry = m_opcode_cache[name.cache_hash() % opcode_cache_size];
+    if (entry.generation == m_current_opcode_generation && entry.name == name)
+    {
+        ++metrics.opcode_cache_hits;
+        return entry.opcode;
+    }
+
+    ++metrics.opcode_cache_misses;
+    entry.name = name;
+    entry.opcode = find_opcode_mnemo_uncached(name, m_current_opcode_generation);
+    entry.generation = m_current_opcode_generation;
+
+    return entry.opcode;
+}
+
+const opcode_t* hlasm_context::find_opcode_mnemo_uncached(id_index name, opcode_generation gen) const
+{
+    if (auto it = opcode_mnemo_.find(name); it != opcode_mnemo_.end())
+    {
+        auto op =
+            std::find_if(it->second.rbegin(), it->second.rend(), [gen](const auto& e) { return e.second <= gen; });
+        if (op != it->second.rend())
+            return &op->first;
+    }
+
+    // all the initial opcodes belong to the generation zero
+    if (auto it = m_initial_opcodes->find(name); it != m_initial_opcodes->end())
+        return &it->second;
+
+    return nullptr;
 }
 
 const opcode_t* hlasm_context::find_any_valid_opcode(id_index name) const
 {
-    if (auto it = opcode_mnemo_.find(name); it != opcode_mnemo_.end() && it->second.back().first)
-        return &it->second.back().first;
+    if (auto it = opcode_mnemo_.find(name); it != opcode_mnemo_.end())
+        return it->second.back().first ? &it->second.back().first : nullptr;
+
+    if (auto it = m_initial_opcodes->find(name); it != m_initial_opcodes->end())
+        return &it->second;
 
     return nullptr;
 }
 
 void hlasm_context::add_mnemonic(id_index mnemo, id_index op_code)
 {
-    auto it = opcode_mnemo_.find(op_code);
-    assert(it != opcode_mnemo_.end() && it->second.back().first);
+    const auto* found = find_opcode_mnemo_uncached(op_code, opcode_generation::current);
+    assert(found && *found);
 
-    opcode_mnemo_[mnemo].emplace_back(it->second.back().first, ++m_current_opcode_generation);
+    const opcode_t op = *found;
+    opcode_mnemo_[mnemo].emplace_back(op, ++m_current_opcode_generation);
 }
 
 void hlasm_context::remove_mnemonic(id_index mnemo)
@@ -897,6 +957,8 @@ std::pair<const macro_invocation*, bool> hlasm_context::enter_macro(
             ord_ctx.symbol_mentioned_on_macro(ids().add(std::move(label)));
     }
 
+    const auto call_site = m_macro_trace ? std::optional(processing_stack_top()) : std::nullopt;
+
     auto [invo, truncated] =
         macro_def->call(std::move(label_param_data), std::move(params), id_storage::well_known::SYSLIST);
     auto* const result = invo.get();
@@ -909,11 +971,17 @@ std::pair<const macro_invocation*, bool> hlasm_context::enter_macro(
 
     ++SYSNDX_;
 
+    if (call_site)
+        trace_macro(&*call_site);
+
     return { result, truncated };
 }
 
 void hlasm_context::leave_macro()
 {
+    if (m_macro_trace)
+        trace_macro(nullptr);
+
     auto mnote_last_max = scope_stack_.back().mnote_max_in_scope;
     scope_stack_.pop_back();
     scope_stack_.back().mnote_last_max = mnote_last_max;
@@ -1037,6 +1105,31 @@ void hlasm_context::update_mnote_max(unsigned mnote_level)
     scope_stack_.back().mnote_max_in_scope = std::max(scope_stack_.back().mnote_max_in_scope, mnote_level);
 }
 
+void hlasm_context::enable_macro_trace(size_t capacity)
+{
+    m_macro_trace = std::make_shared<macro_trace>(capacity, ids_);
+}
+
+std::shared_ptr<const macro_trace> hlasm_context::get_macro_trace() const { return m_macro_trace; }
+
+void hlasm_context::trace_macro(const processing_frame* call_site)
+{
+    const bool enter = call_site != nullptr;
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+    m_macro_trace->record(macro_trace_event {
+        .timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count(),
+        .statements = metrics.open_code_statements + metrics.copy_statements + metrics.macro_statements
+            + metrics.lookahead_statements + metrics.reparsed_statements,
+        .name = scope_stack_.back().this_macro->id,
+        .call_site = enter && call_site->resource_loc ? m_macro_trace->call_site(*call_site->resource_loc)
+                                                      : macro_trace_event::no_call_site,
+        .call_line = enter ? (std::uint32_t)call_site->pos.line : 0,
+        .depth = (std::uint16_t)(scope_stack_.size() - 1),
+        .kind = enter ? macro_trace_event_kind::enter : macro_trace_event_kind::exit,
+    });
+}
+
 void hlasm_context::using_add(id_index label,
     std::unique_ptr<expressions::mach_expression> begin,
     std::unique_ptr<expressions::mach_expression> end,
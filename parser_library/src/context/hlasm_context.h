@@ -16,6 +16,7 @@
 #define CONTEXT_HLASM_CONTEXT_H
 
 #include <cassert>
+#include <array>
 #include <deque>
 #include <map>
 #include <memory>
@@ -40,6 +41,7 @@ namespace hlasm_plugin::parser_library::expressions {
 class mach_expression;
 } // namespace hlasm_plugin::parser_library::expressions
 namespace hlasm_plugin::parser_library::context {
+class macro_trace;
 class using_collection;
 } // namespace hlasm_plugin::parser_library::context
 
@@ -59,6 +61,7 @@ private:
     using copy_member_storage = std::unordered_map<id_index, copy_member_ptr>;
     using instruction_storage = std::unordered_map<id_index, opcode_t::opcode_variant>;
     using opcode_map = std::unordered_map<id_index, std::vector<std::pair<opcode_t, opcode_generation>>>;
+    using initial_opcode_map = std::unordered_map<id_index, opcode_t>;
     using global_variable_storage =
         std::unordered_map<id_index, std::variant<set_symbol<A_t>, set_symbol<B_t>, set_symbol<C_t>>>;
 
@@ -71,10 +74,24 @@ private:
     std::unordered_map<id_index, macro_def_ptr> external_macros_;
     // storage of copy members
     copy_member_storage copy_members_;
-    // map of OPSYN mnemonics
+    // instructions of the active instruction set, shared by all contexts using it
+    std::shared_ptr<const initial_opcode_map> m_initial_opcodes;
+    // OPSYN mnemonics and macro definitions layered over the initial opcodes
     opcode_map opcode_mnemo_;
     opcode_generation m_current_opcode_generation = opcode_generation::zero;
 
+    // direct-mapped cache of the current opcode lookups, entries from older generations are stale
+    struct opcode_cache_entry
+    {
+        id_index name;
+        const opcode_t* opcode = nullptr;
+        opcode_generation generation = opcode_generation::current;
+    };
+    static constexpr size_t opcode_cache_size = 256;
+    mutable std::array<opcode_cache_entry, opcode_cache_size> m_opcode_cache;
+
+    const opcode_t* find_opcode_mnemo_uncached(id_index name, opcode_generation gen) const;
+
     // storage of identifiers
     std::shared_ptr<id_storage> ids_;
 
@@ -92,8 +109,8 @@ private:
     asm_option asm_options_;
     static constexpr alignment sectalgn = doubleword;
 
-    // map of active instructions in HLASM
-    static void init_instruction_map(opcode_map& opcodes, id_storage& ids, instruction_set_version active_instr_set);
+    // map of active instructions in HLASM, built once per instruction set
+    static std::shared_ptr<const initial_opcode_map> get_initial_opcodes(instruction_set_version active_instr_set);
     void add_global_system_variables(sysvar_map& sysvars);
     void add_scoped_system_variables(sysvar_map& sysvars, size_t skip_last, bool globals_only);
 
@@ -128,6 +145,10 @@ private:
 
     label_storage opencode_sequence_symbols;
 
+    std::shared_ptr<macro_trace> m_macro_trace;
+    // records macro entry when the call site is provided, exit otherwise
+    void trace_macro(const processing_frame* call_site);
+
 public:
     hlasm_context(utils::resource::resource_location file_loc = utils::resource::resource_location(""),
         asm_option asm_opts = {},
@@ -188,8 +209,8 @@ public:
     // field that accessed ordinary assembly context
     ordinary_assembly_context ord_ctx;
 
-    // performance metrics
-    performance_metrics metrics;
+    // performance metrics, the opcode cache statistics are updated by const lookups
+    mutable performance_metrics metrics;
 
     // return map of global set vars
     const global_variable_storage& globals() const;
@@ -215,6 +236,7 @@ public:
     void add_mnemonic(id_index mnemo, id_index op_code);
     // removes opsyn mnemonic
     void remove_mnemonic(id_index mnemo);
+    // only the mnemonics changed by OPSYN or macro definitions
     const opcode_map& opcode_mnemo_storage() const;
 
     // checks whether the symbol is an operation code (is a valid instruction or a mnemonic)
@@ -320,6 +342,10 @@ public:
     const auto& get_opencode_sequence_symbols() const noexcept { return opencode_sequence_symbols; }
 
     sysvar_map get_system_variables(const code_scope&);
+
+    // starts recording macro entries and exits, keeps at most the last "capacity" events
+    void enable_macro_trace(size_t capacity);
+    std::shared_ptr<const macro_trace> get_macro_trace() const;
 };
 
 bool test_symbol_for_read(const variable_symbol* var,
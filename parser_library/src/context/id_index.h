@@ -17,6 +17,7 @@
 
 #include <cassert>
 #include <compare>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <string>
@@ -101,6 +102,17 @@ public:
     {
         return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(m_buffer), buffer_size));
     }
+
+    // cheap hash of the buffer, intended for small direct-mapped caches
+    size_t cache_hash() const noexcept
+    {
+        std::uint64_t parts[buffer_size / sizeof(std::uint64_t)];
+        std::memcpy(parts, m_buffer, sizeof(parts));
+        std::uint64_t h = 0;
+        for (auto p : parts)
+            h = (h ^ p) * 0x9E3779B97F4A7C15u;
+        return (size_t)(h >> 32);
+    }
 };
 } // namespace hlasm_plugin::parser_library::context
 
@@ -131,15 +131,18 @@ const semantics::instruction_si literal_pool::literal_postponed_statement::empty
 const processing::processing_format literal_pool::literal_postponed_statement::dc_format(
     processing::processing_kind::ORDINARY, processing::processing_form::ASM, processing::operand_occurrence::PRESENT);
 
-void literal_pool::generate_pool(diagnosable_ctx& diags, index_t<using_collection> active_using, const library_info& li)
+utils::task literal_pool::generate_pool(
+    diagnosable_ctx& diags, index_t<using_collection> active_using, const library_info& li)
 {
     ordinary_assembly_context& ord_ctx = hlasm_ctx.ord_ctx;
 
     if (m_pending_literals.empty())
-        return;
+        co_return;
 
     for (auto& [it, size, alignment] : m_pending_literals)
     {
+        co_await utils::task::yield();
+
         const auto& lit = it->first.lit;
         if (!lit->access_data_def_type()) // unknown type
             continue;
@@ -173,6 +176,8 @@ void literal_pool::generate_pool(diagnosable_ctx& diags, index_t<using_collectio
 
     for (const auto& [it, size, alignment] : m_pending_literals)
     {
+        co_await utils::task::yield();
+
         const auto& lit_key = it->first;
         const auto& lit = lit_key.lit;
         const auto& lit_val = it->second;
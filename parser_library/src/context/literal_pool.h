@@ -24,6 +24,7 @@
 #include "source_context.h"
 #include "tagged_index.h"
 #include "utils/similar.h"
+#include "utils/task.h"
 
 namespace hlasm_plugin::parser_library {
 class diagnosable_ctx;
@@ -127,7 +128,9 @@ public:
     bool defined_for_ca_expr(std::shared_ptr<const expressions::data_definition> dd) const;
     void mentioned_in_ca_expr(std::shared_ptr<const expressions::data_definition> dd);
 
-    void generate_pool(diagnosable_ctx& diags, index_t<using_collection> active_using, const library_info& li);
+    // yields after every literal, run it to completion when the caller cannot be suspended
+    [[nodiscard]] utils::task generate_pool(
+        diagnosable_ctx& diags, index_t<using_collection> active_using, const library_info& li);
     size_t current_generation() const { return m_current_literal_pool_generation; }
 
     // testing
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "macro_trace.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include "nlohmann/json.hpp"
+#include "utils/resource_location.h"
+
+namespace hlasm_plugin::parser_library::context {
+
+macro_trace::macro_trace(size_t capacity, std::shared_ptr<const id_storage> ids)
+    : m_capacity(std::max(capacity, (size_t)1))
+    , m_ids(std::move(ids))
+{}
+
+std::uint32_t macro_trace::call_site(const utils::resource::resource_location& loc)
+{
+    auto [it, inserted] = m_call_site_index.try_emplace(&loc, (std::uint32_t)m_call_sites.size());
+    if (inserted)
+        m_call_sites.emplace_back(loc.get_uri());
+    return it->second;
+}
+
+std::string_view macro_trace::call_site_uri(const macro_trace_event& e) const
+{
+    if (e.call_site >= m_call_sites.size())
+        return {};
+    return m_call_sites[e.call_site];
+}
+
+void macro_trace::record(const macro_trace_event& e)
+{
+    if (m_events.size() < m_capacity)
+    {
+        m_events.push_back(e);
+        return;
+    }
+
+    m_events[m_next] = e;
+    m_next = (m_next + 1) % m_capacity;
+    ++m_dropped;
+}
+
+std::vector<macro_trace_event> macro_trace::events() const
+{
+    std::vector<macro_trace_event> result;
+    result.reserve(m_events.size());
+    result.insert(result.end(), m_events.begin() + m_next, m_events.end());
+    result.insert(result.end(), m_events.begin(), m_events.begin() + m_next);
+    return result;
+}
+
+std::string to_chrome_trace(const macro_trace& trace)
+{
+    const auto events = trace.events();
+    const auto base = events.empty() ? 0 : events.front().timestamp;
+
+    auto trace_events = nlohmann::json::array();
+    for (const auto& e : events)
+    {
+        auto& j = trace_events.emplace_back(nlohmann::json {
+            { "name", std::string(e.name.to_string_view()) },
+            { "cat", "macro" },
+            { "ph", e.kind == macro_trace_event_kind::enter ? "B" : "E" },
+            { "ts", (double)(e.timestamp - base) / 1000 },
+            { "pid", 0 },
+            { "tid", 0 },
+        });
+        auto& args = j["args"];
+        args["depth"] = e.depth;
+        args["statements"] = e.statements;
+        if (const auto uri = trace.call_site_uri(e); e.kind == macro_trace_event_kind::enter && !uri.empty())
+            args["call_site"] = std::string(uri).append(":").append(std::to_string(e.call_line + 1));
+    }
+
+    return nlohmann::json {
+        { "traceEvents", std::move(trace_events) },
+        { "displayTimeUnit", "ms" },
+        { "otherData", { { "droppedEvents", trace.dropped() } } },
+    }
+        .dump();
+}
+
+std::string to_folded_stacks(const macro_trace& trace)
+{
+    struct frame
+    {
+        id_index name;
+        std::int64_t start;
+        std::int64_t children = 0;
+    };
+
+    const auto events = trace.events();
+
+    std::vector<frame> stack;
+    std::map<std::string, std::int64_t> self_times;
+
+    const auto stack_name = [&stack]() {
+        std::string result;
+        for (const auto& f : stack)
+        {
+            if (!result.empty())
+                result.push_back(';');
+            result.append(f.name.to_string_view());
+        }
+        return result;
+    };
+
+    const auto pop = [&stack, &self_times, &stack_name](std::int64_t now) {
+        const auto total = now - stack.back().start;
+        self_times[stack_name()] += total - stack.back().children;
+        stack.pop_back();
+        if (!stack.empty())
+            stack.back().children += total;
+    };
+
+    for (const auto& e : events)
+    {
+        if (e.kind == macro_trace_event_kind::enter)
+            stack.push_back({ e.name, e.timestamp });
+        else if (!stack.empty()) // exits of entries overwritten in the ring buffer are ignored
+            pop(e.timestamp);
+    }
+
+    // close invocations that were still active when the trace was taken
+    while (!stack.empty())
+        pop(events.back().timestamp);
+
+    std::string result;
+    for (const auto& [name, ns] : self_times)
+        result.append(name).append(" ").append(std::to_string(ns / 1000)).append("\n");
+
+    return result;
+}
+
+std::string export_macro_trace(const macro_trace& trace, macro_trace_format format)
+{
+    switch (format)
+    {
+        case macro_trace_format::chrome_trace:
+            return to_chrome_trace(trace);
+        case macro_trace_format::folded_stacks:
+            return to_folded_stacks(trace);
+    }
+    return {};
+}
+
+} // namespace hlasm_plugin::parser_library::context
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef CONTEXT_MACRO_TRACE_H
+#define CONTEXT_MACRO_TRACE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "id_index.h"
+#include "protocol.h"
+
+namespace hlasm_plugin::utils::resource {
+class resource_location;
+} // namespace hlasm_plugin::utils::resource
+
+namespace hlasm_plugin::parser_library::context {
+class id_storage;
+
+enum class macro_trace_event_kind : std::uint8_t
+{
+    enter,
+    exit,
+};
+
+// compact record of a single macro entry or exit
+struct macro_trace_event
+{
+    static constexpr std::uint32_t no_call_site = (std::uint32_t)-1;
+
+    // steady clock time in nanoseconds
+    std::int64_t timestamp;
+    // number of statements executed since the start of the analysis
+    std::uint64_t statements;
+    id_index name;
+    // index of the call site in the trace
+    std::uint32_t call_site;
+    std::uint32_t call_line;
+    std::uint16_t depth;
+    macro_trace_event_kind kind;
+};
+
+// fixed size ring buffer of macro entry/exit events, the oldest events are overwritten when full
+class macro_trace
+{
+    std::vector<macro_trace_event> m_events;
+    size_t m_capacity;
+    size_t m_next = 0;
+    size_t m_dropped = 0;
+
+    // the trace outlives the analysis, so it keeps the identifiers alive and owns the call site URIs
+    std::shared_ptr<const id_storage> m_ids;
+    std::vector<std::string> m_call_sites;
+    // only used while recording, the keys are never dereferenced
+    std::unordered_map<const utils::resource::resource_location*, std::uint32_t> m_call_site_index;
+
+public:
+    macro_trace(size_t capacity, std::shared_ptr<const id_storage> ids);
+
+    std::uint32_t call_site(const utils::resource::resource_location& loc);
+    std::string_view call_site_uri(const macro_trace_event& e) const;
+
+    void record(const macro_trace_event& e);
+
+    size_t capacity() const { return m_capacity; }
+    size_t dropped() const { return m_dropped; }
+
+    // events in chronological order
+    std::vector<macro_trace_event> events() const;
+};
+
+// Chrome trace-event JSON (chrome://tracing, Perfetto)
+std::string to_chrome_trace(const macro_trace& trace);
+// folded stacks (flamegraph.pl, speedscope), values are self times in microseconds
+std::string to_folded_stacks(const macro_trace& trace);
+
+std::string export_macro_trace(const macro_trace& trace, macro_trace_format format);
+
+} // namespace hlasm_plugin::parser_library::context
+
+#endif
@@ -15,11 +15,16 @@
 #ifndef CONTEXT_DEPENDABLE_H
 #define CONTEXT_DEPENDABLE_H
 
+#include <cstddef>
 #include <optional>
 #include <variant>
 
 #include "dependency_collector.h"
 
+namespace hlasm_plugin::parser_library {
+struct performance_metrics;
+} // namespace hlasm_plugin::parser_library
+
 namespace hlasm_plugin::parser_library::expressions {
 struct data_definition;
 } // namespace hlasm_plugin::parser_library::expressions
@@ -34,6 +39,14 @@ struct symbol_candidate
     bool mentioned;
 };
 
+// Defined ordinary symbols never change their value, so results of evaluations that depend only on them
+// remain valid while the epoch (one per ordinary assembly context) is the same
+struct evaluation_epoch
+{
+    size_t id;
+    performance_metrics* metrics;
+};
+
 // interface for obtaining symbol from its name
 class dependency_solver
 {
@@ -46,6 +59,8 @@ public:
         id_index label, const section* owner, int32_t offset, bool long_offset) const = 0;
     virtual std::variant<const symbol*, symbol_candidate> get_symbol_candidate(id_index name) const = 0;
     virtual std::string get_opcode_attr(id_index symbol) const = 0;
+    // nullptr when the evaluation results must not be reused
+    virtual const evaluation_epoch* get_evaluation_epoch() const = 0;
 
 protected:
     ~dependency_solver() = default;
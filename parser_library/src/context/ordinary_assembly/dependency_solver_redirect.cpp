@@ -48,4 +48,9 @@ std::string dependency_solver_redirect::get_opcode_attr(id_index symbol) const
     return m_base->get_opcode_attr(symbol);
 }
 
+const evaluation_epoch* dependency_solver_redirect::get_evaluation_epoch() const
+{
+    return m_base->get_evaluation_epoch();
+}
+
 } // namespace hlasm_plugin::parser_library::context
@@ -262,7 +262,7 @@ std::variant<space_ptr, address> location_counter::restore_from_unresolved_value
         for (auto& switched_data : switched_org_data_)
         {
             if (switched_data.matches_first_space(sp.get()))
-                org_data_.emplace_back(std::move(switched_data)).unknown_parts.front().unknown_space = new_sp;
+                org_data_.emplace_back(std::move(switched_data)).resolve_space(sp.get(), new_sp);
             else
                 org_data_.emplace_back(std::move(switched_data));
         }
@@ -20,6 +20,28 @@
 
 using namespace hlasm_plugin::parser_library::context;
 
+void space_part_index::add(std::list<space_storage_t>::iterator it)
+{
+    if (valid_)
+        map_.try_emplace(it->unknown_space.get(), it);
+}
+
+void space_part_index::remove(const space* sp) { map_.erase(sp); }
+
+std::list<space_storage_t>::iterator space_part_index::find(const space* sp, std::list<space_storage_t>& parts)
+{
+    if (!valid_)
+    {
+        map_.clear();
+        for (auto it = parts.begin(); it != parts.end(); ++it)
+            map_.try_emplace(it->unknown_space.get(), it);
+        valid_ = true;
+    }
+
+    auto it = map_.find(sp);
+    return it == map_.end() ? parts.end() : it->second;
+}
+
 location_counter_data::location_counter_data()
     : location_counter_data(loctr_data_kind::UNKNOWN_MAX)
 {}
@@ -38,6 +60,7 @@ void location_counter_data::append_space(space_ptr sp)
     cached_pseudo_relative_spaces_for_address.reset();
 
     unknown_parts.emplace_back(space_storage_t { std::move(sp), 0 });
+    part_index.add(std::prev(unknown_parts.end()));
     if (cached_spaces_for_address)
         cached_spaces_for_address->push_back({ unknown_parts.back().unknown_space, 1 });
     current_safe_area = 0;
@@ -62,6 +85,9 @@ void location_counter_data::append_data(location_counter_data data)
 
     data.unknown_parts.pop_front(); // the first unknown part is substitiuted by this data
 
+    // iterators remain valid after the splice
+    for (auto it = data.unknown_parts.begin(); it != data.unknown_parts.end(); ++it)
+        part_index.add(it);
     unknown_parts.splice(unknown_parts.end(), data.unknown_parts);
 
     current_safe_area = data.current_safe_area;
@@ -69,8 +95,7 @@ void location_counter_data::append_data(location_counter_data data)
 
 void location_counter_data::resolve_space(const space* sp, size_t length)
 {
-    auto match = std::find_if(
-        unknown_parts.begin(), unknown_parts.end(), [sp](const auto& p) { return p.unknown_space.get() == sp; });
+    auto match = part_index.find(sp, unknown_parts);
     if (match == unknown_parts.end())
         return;
 
@@ -84,19 +109,21 @@ void location_counter_data::resolve_space(const space* sp, size_t length)
     else
         std::prev(match)->storage_after += match->storage_after + length;
 
+    part_index.remove(sp);
     unknown_parts.erase(match);
 }
 
 void location_counter_data::resolve_space(const space* sp, space_ptr new_space)
 {
-    auto match = std::find_if(
-        unknown_parts.begin(), unknown_parts.end(), [sp](const auto& p) { return p.unknown_space.get() == sp; });
+    auto match = part_index.find(sp, unknown_parts);
     if (match == unknown_parts.end())
         return;
 
     cached_spaces_for_address.reset();
     cached_pseudo_relative_spaces_for_address.reset();
+    part_index.remove(sp);
     match->unknown_space = std::move(new_space);
+    part_index.add(match);
 }
 
 bool location_counter_data::has_alignment(alignment align) const
@@ -18,6 +18,7 @@
 #include <list>
 #include <memory>
 #include <optional>
+#include <unordered_map>
 
 #include "address.h"
 #include "alignment.h"
@@ -80,6 +81,31 @@ struct space_storage_t
     int storage_after;
 };
 
+// finds the unknown part of a space without walking the whole list, copies start empty and are rebuilt on demand
+class space_part_index
+{
+    std::unordered_map<const space*, std::list<space_storage_t>::iterator> map_;
+    bool valid_ = true;
+
+public:
+    space_part_index() = default;
+    space_part_index(const space_part_index&)
+        : valid_(false)
+    {}
+    space_part_index(space_part_index&&) noexcept = default;
+    space_part_index& operator=(const space_part_index&)
+    {
+        map_.clear();
+        valid_ = false;
+        return *this;
+    }
+    space_part_index& operator=(space_part_index&&) noexcept = default;
+
+    void add(std::list<space_storage_t>::iterator it);
+    void remove(const space* sp);
+    std::list<space_storage_t>::iterator find(const space* sp, std::list<space_storage_t>& parts);
+};
+
 // data of location counter for the active ORG
 struct location_counter_data
 {
@@ -92,6 +118,8 @@ struct location_counter_data
     int current_safe_area;
     loctr_data_kind kind;
 
+    space_part_index part_index;
+
     mutable std::shared_ptr<std::vector<address::space_entry>> cached_spaces_for_address;
     mutable std::optional<address::space_list> cached_pseudo_relative_spaces_for_address;
 
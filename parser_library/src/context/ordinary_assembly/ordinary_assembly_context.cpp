@@ -15,6 +15,7 @@
 #include "ordinary_assembly_context.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <memory>
 
@@ -40,10 +41,19 @@ void ordinary_assembly_context::create_private_section()
 
 const std::vector<std::unique_ptr<section>>& ordinary_assembly_context::sections() const { return sections_; }
 
+namespace {
+size_t next_evaluation_epoch()
+{
+    static std::atomic<size_t> last_epoch = 0;
+    return ++last_epoch;
+}
+} // namespace
+
 ordinary_assembly_context::ordinary_assembly_context(hlasm_context& hlasm_ctx)
     : curr_section_(nullptr)
     , m_literals(std::make_unique<literal_pool>(hlasm_ctx))
     , hlasm_ctx_(hlasm_ctx)
+    , m_evaluation_epoch { next_evaluation_epoch(), &hlasm_ctx.metrics }
     , m_symbol_dependencies(std::make_unique<symbol_dependency_tables>(*this))
 {}
 ordinary_assembly_context::ordinary_assembly_context(ordinary_assembly_context&&) noexcept = default;
@@ -366,10 +376,10 @@ section* ordinary_assembly_context::create_section(id_index name, section_kind k
 
 size_t ordinary_assembly_context::current_literal_pool_generation() const { return m_literals->current_generation(); }
 
-void ordinary_assembly_context::generate_pool(
+utils::task ordinary_assembly_context::generate_pool(
     diagnosable_ctx& diags, index_t<using_collection> active_using, const library_info& li) const
 {
-    m_literals->generate_pool(diags, active_using, li);
+    return m_literals->generate_pool(diags, active_using, li);
 }
 bool ordinary_assembly_context::is_using_label(id_index name) const
 {
@@ -27,6 +27,7 @@
 #include "section.h"
 #include "symbol.h"
 #include "tagged_index.h"
+#include "utils/task.h"
 
 namespace hlasm_plugin::parser_library {
 class diagnosable_ctx;
@@ -75,6 +76,8 @@ class ordinary_assembly_context
 
     hlasm_context& hlasm_ctx_;
 
+    evaluation_epoch m_evaluation_epoch;
+
     std::unique_ptr<symbol_dependency_tables> m_symbol_dependencies;
 
 public:
@@ -169,7 +172,8 @@ public:
 
     literal_pool& literals() { return *m_literals; }
     const literal_pool& literals() const { return *m_literals; }
-    void generate_pool(diagnosable_ctx& diags, index_t<using_collection> active_using, const library_info& li) const;
+    [[nodiscard]] utils::task generate_pool(
+        diagnosable_ctx& diags, index_t<using_collection> active_using, const library_info& li) const;
     location_counter* implicit_ltorg_target()
     {
         if (!first_control_section_)
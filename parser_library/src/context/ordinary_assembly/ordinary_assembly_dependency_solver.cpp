@@ -138,4 +138,9 @@ std::string ordinary_assembly_dependency_solver::get_opcode_attr(id_index name)
     return result;
 }
 
+const evaluation_epoch* ordinary_assembly_dependency_solver::get_evaluation_epoch() const
+{
+    return &ord_context.m_evaluation_epoch;
+}
+
 } // namespace hlasm_plugin::parser_library::context
@@ -56,6 +56,7 @@ public:
         id_index label, const section* owner, int32_t offset, bool long_offset) const override;
     std::variant<const symbol*, symbol_candidate> get_symbol_candidate(id_index name) const override;
     std::string get_opcode_attr(id_index name) const override;
+    const evaluation_epoch* get_evaluation_epoch() const override;
 
     dependency_evaluation_context derive_current_dependency_evaluation_context() const&;
     dependency_evaluation_context derive_current_dependency_evaluation_context() &&;
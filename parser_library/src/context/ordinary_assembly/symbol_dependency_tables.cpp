@@ -23,6 +23,7 @@
 #if __cpp_lib_polymorphic_allocator >= 201902L && __cpp_lib_memory_resource >= 201603L
 #    include <memory_resource>
 #endif
+#include <numeric>
 #include <queue>
 #include <stack>
 #include <unordered_set>
@@ -697,9 +698,7 @@ void symbol_dependency_tables::add_dependency(space_ptr target,
 
     if (dependency_source_stmt)
     {
-        auto [sit, sinserted] = m_postponed_stmts.try_emplace(std::move(dependency_source_stmt), dep_ctx);
-
-        assert(sinserted);
+        auto sit = add_postponed(std::move(dependency_source_stmt), dep_ctx);
 
         m_dependency_source_stmts.emplace(dependant(std::move(target)), statement_ref(sit, 1));
     }
@@ -820,14 +819,28 @@ bool symbol_dependency_tables::check_loctr_cycle(const library_info& li)
 std::vector<std::pair<post_stmt_ptr, dependency_evaluation_context>> symbol_dependency_tables::collect_postponed()
 {
     std::vector<std::pair<post_stmt_ptr, dependency_evaluation_context>> res;
+    std::vector<size_t> sequence;
 
     res.reserve(m_postponed_stmts.size());
+    sequence.reserve(m_postponed_stmts.size());
     for (auto it = m_postponed_stmts.begin(); it != m_postponed_stmts.end();)
     {
         auto node = m_postponed_stmts.extract(it++);
-        res.emplace_back(std::move(node.key()), std::move(node.mapped()));
+        sequence.emplace_back(node.mapped().sequence);
+        res.emplace_back(std::move(node.key()), std::move(node.mapped().dep_ctx));
     }
 
+    // the map is keyed by pointers, restore the original order to keep diagnostics deterministic
+    std::vector<size_t> order(res.size());
+    std::iota(order.begin(), order.end(), (size_t)0);
+    std::sort(order.begin(), order.end(), [&sequence](size_t l, size_t r) { return sequence[l] < sequence[r]; });
+
+    std::vector<std::pair<post_stmt_ptr, dependency_evaluation_context>> ordered;
+    ordered.reserve(res.size());
+    for (auto idx : order)
+        ordered.emplace_back(std::move(res[idx]));
+    res.swap(ordered);
+
     m_postponed_stmts.clear();
     m_dependency_source_stmts.clear();
     m_dependencies.clear();
@@ -839,10 +852,23 @@ std::vector<std::pair<post_stmt_ptr, dependency_evaluation_context>> symbol_depe
     return res;
 }
 
-void symbol_dependency_tables::resolve_all_as_default()
+std::unordered_map<post_stmt_ptr, postponed_statement_entry>::iterator symbol_dependency_tables::add_postponed(
+    post_stmt_ptr stmt, const dependency_evaluation_context& dep_ctx)
+{
+    auto [it, inserted] = m_postponed_stmts.try_emplace(std::move(stmt), dep_ctx, m_postponed_stmts_sequence++);
+
+    assert(inserted);
+
+    return it;
+}
+
+utils::task symbol_dependency_tables::resolve_all_as_default()
 {
     for (auto& [target, dep_src] : m_dependencies)
+    {
         resolve_dependant_default(target);
+        co_await utils::task::yield();
+    }
 }
 
 statement_ref::statement_ref(ref_t stmt_ref, size_t ref_count)
@@ -901,9 +927,7 @@ void dependency_adder::finish()
     if (m_ref_count == 0)
         return;
 
-    auto [it, inserted] = m_owner.m_postponed_stmts.try_emplace(std::move(m_source_stmt), m_dep_ctx);
-
-    assert(inserted);
+    auto it = m_owner.add_postponed(std::move(m_source_stmt), m_dep_ctx);
 
     statement_ref ref(it, m_ref_count);
 
@@ -30,6 +30,7 @@
 #include "postponed_statement.h"
 #include "tagged_index.h"
 #include "utils/filter_vector.h"
+#include "utils/task.h"
 
 namespace hlasm_plugin::parser_library {
 class library_info;
@@ -65,10 +66,23 @@ struct dependency_evaluation_context
     {}
 };
 
+// postponed statement bookkeeping, the sequence number preserves the order in which statements were postponed
+struct postponed_statement_entry
+{
+    dependency_evaluation_context dep_ctx;
+    // only restores the source order for the checks, it does not make them safe to run in parallel
+    size_t sequence;
+
+    postponed_statement_entry(dependency_evaluation_context dep_ctx, size_t sequence)
+        : dep_ctx(std::move(dep_ctx))
+        , sequence(sequence)
+    {}
+};
+
 // helper structure to count dependencies of a statement
 struct statement_ref
 {
-    using ref_t = std::unordered_map<post_stmt_ptr, dependency_evaluation_context>::const_iterator;
+    using ref_t = std::unordered_map<post_stmt_ptr, postponed_statement_entry>::const_iterator;
     statement_ref(ref_t stmt_ref, size_t ref_count = (size_t)1);
 
     ref_t stmt_ref;
@@ -119,7 +133,11 @@ class symbol_dependency_tables
     // addresses where dependencies are from
     std::unordered_map<dependant, addr_res_ptr> m_dependency_source_addrs;
     // list of statements containing dependencies that can not be checked yet
-    std::unordered_map<post_stmt_ptr, dependency_evaluation_context> m_postponed_stmts;
+    std::unordered_map<post_stmt_ptr, postponed_statement_entry> m_postponed_stmts;
+    size_t m_postponed_stmts_sequence = 0;
+
+    std::unordered_map<post_stmt_ptr, postponed_statement_entry>::iterator add_postponed(
+        post_stmt_ptr stmt, const dependency_evaluation_context& dep_ctx);
 
     ordinary_assembly_context& m_sym_ctx;
 
@@ -201,10 +219,11 @@ public:
     bool check_loctr_cycle(const library_info& li);
 
     // collect all postponed statements either if they still contain dependent objects
+    // statements are returned in the order in which they were postponed (i.e. in the source order)
     std::vector<std::pair<post_stmt_ptr, dependency_evaluation_context>> collect_postponed();
 
-    // assign default values to all unresoved dependants
-    void resolve_all_as_default();
+    // assign default values to all unresoved dependants, yields after every dependant
+    [[nodiscard]] utils::task resolve_all_as_default();
 
     friend dependency_adder;
 };
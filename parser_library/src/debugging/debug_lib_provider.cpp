@@ -18,6 +18,7 @@
 
 #include "analyzer.h"
 #include "utils/task.h"
+#include "workspaces/file.h"
 #include "workspaces/file_manager.h"
 #include "workspaces/library.h"
 #include "workspaces/workspace.h"
@@ -62,7 +63,8 @@ bool debug_lib_provider::has_library(std::string_view library, utils::resource::
     return false;
 }
 
-utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>>
+utils::value_task<
+    std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, utils::resource::resource_location>>>
 debug_lib_provider::get_library(std::string library)
 {
     utils::resource::resource_location url;
@@ -75,7 +77,7 @@ debug_lib_provider::get_library(std::string library)
         if (!content_o.has_value())
             break;
 
-        co_return std::pair(std::move(content_o).value(), std::move(url));
+        co_return std::pair(workspaces::make_text_buffer(std::move(content_o).value()), std::move(url));
     }
     co_return std::nullopt;
 }
@@ -60,7 +60,8 @@ public:
 
     bool has_library(std::string_view library, utils::resource::resource_location* loc) override;
 
-    [[nodiscard]] utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>>
+    [[nodiscard]] utils::value_task<
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, utils::resource::resource_location>>>
     get_library(std::string library) override;
 
     [[nodiscard]] utils::task prefetch_libraries() const;
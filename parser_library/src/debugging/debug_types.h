@@ -58,19 +58,16 @@ struct stack_frame
 
 struct scope
 {
-    scope(std::string name, var_reference_t ref, source source)
+    scope(std::string name, var_reference_t ref, source source, size_t named_variables)
         : name(std::move(name))
         , scope_source(std::move(source))
         , var_reference(ref)
+        , named_variables(named_variables)
     {}
     std::string name;
     source scope_source;
     var_reference_t var_reference;
-};
-
-struct variable_store
-{
-    std::vector<variable_ptr> variables;
+    size_t named_variables;
 };
 
 } // namespace hlasm_plugin::parser_library::debugging
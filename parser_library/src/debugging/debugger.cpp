@@ -19,7 +19,9 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -104,8 +106,20 @@ class debugger::impl final : public processing::statement_analyzer
     std::vector<scope> scopes_;
     std::unordered_map<frame_id_t, context::hlasm_context::sysvar_map> last_system_variables_;
 
-    std::unordered_map<size_t, variable_store> variables_;
+    std::unordered_map<size_t, std::vector<variable_ptr>> variables_;
     size_t next_var_ref_ = 1;
+
+    // Content of a scope is only collected when the scope is listed, the variables are created and sorted when the
+    // client asks for them, one page at a time.
+    using scope_entry =
+        std::variant<const context::symbol*, const context::set_symbol_base*, const context::macro_param_base*>;
+    struct lazy_scope
+    {
+        std::vector<scope_entry> entries;
+        std::vector<variable_ptr> variables;
+        bool sorted = false;
+    };
+    std::unordered_map<size_t, lazy_scope> lazy_scopes_;
     context::processing_stack_details_t proc_stack_;
 
     std::unordered_map<utils::resource::resource_location,
@@ -115,10 +129,55 @@ class debugger::impl final : public processing::statement_analyzer
 
     size_t add_variable(std::vector<variable_ptr> vars)
     {
-        variables_[next_var_ref_].variables = std::move(vars);
+        variables_[next_var_ref_] = std::move(vars);
+        return next_var_ref_++;
+    }
+
+    size_t add_scope(std::vector<scope_entry> entries)
+    {
+        lazy_scopes_[next_var_ref_].entries = std::move(entries);
         return next_var_ref_++;
     }
 
+    static std::string_view entry_name(const scope_entry& e)
+    {
+        return std::visit(
+            [](const auto* v) {
+                if constexpr (std::is_same_v<decltype(v), const context::symbol*>)
+                    return v->name().to_string_view();
+                else
+                    return v->id.to_string_view();
+            },
+            e);
+    }
+
+    static variable_ptr create_variable(const scope_entry& e)
+    {
+        return std::visit(
+            [](const auto* v) -> variable_ptr {
+                using T = std::remove_cvref_t<decltype(*v)>;
+                if constexpr (std::is_same_v<T, context::symbol>)
+                    return std::make_unique<ordinary_symbol_variable>(*v);
+                else if constexpr (std::is_same_v<T, context::set_symbol_base>)
+                    return std::make_unique<set_symbol_variable>(*v);
+                else
+                    return std::make_unique<macro_param_variable>(*v, std::vector<context::A_t> {});
+            },
+            e);
+    }
+
+    // children of composite variables are prepared only for the variables that are actually shown
+    void prepare_children(std::span<const variable_ptr> vars)
+    {
+        for (const auto& var : vars)
+        {
+            if (var->is_scalar() || var->var_reference)
+                continue;
+
+            var->var_reference = add_variable(var->values());
+        }
+    }
+
     utils::task analyzer_task;
 
     utils::task start_main_analyzer(utils::resource::resource_location open_code_location,
@@ -260,6 +319,7 @@ public:
         if (stop_on_next_stmt_ || breakpoint_hit || (stop_on_stack_changes_ && stack_condition_violated(stack_node)))
         {
             variables_.clear();
+            lazy_scopes_.clear();
             stack_frames_.clear();
             scopes_.clear();
             proc_stack_ = std::move(stack);
@@ -365,9 +425,9 @@ public:
         if (frame_id >= proc_stack_.size())
             return scopes_;
 
-        std::vector<variable_ptr> scope_vars;
-        std::vector<variable_ptr> globals;
-        std::vector<variable_ptr> ordinary_symbols;
+        std::vector<scope_entry> scope_vars;
+        std::vector<scope_entry> globals;
+        std::vector<scope_entry> ordinary_symbols;
         // we show only global variables that are valid for current scope,
         // moreover if we show variable in globals, we do not show it in locals
 
@@ -379,7 +439,7 @@ public:
             {
                 if (name.empty())
                     continue;
-                scope_vars.push_back(std::make_unique<macro_param_variable>(*value, std::vector<context::A_t> {}));
+                scope_vars.emplace_back(value.get());
             }
         }
 
@@ -387,9 +447,9 @@ public:
         {
             const auto& [ref, _data, global] = value_type;
             if (global)
-                globals.push_back(std::make_unique<set_symbol_variable>(*ref));
+                globals.emplace_back(ref);
             else
-                scope_vars.push_back(std::make_unique<set_symbol_variable>(*ref));
+                scope_vars.emplace_back(ref);
         }
 
         auto [sysvars, _] = last_system_variables_.try_emplace(frame_id, ctx_->get_system_variables(current_scope));
@@ -397,50 +457,66 @@ public:
         {
             const auto& [value, global] = value_type;
             if (global)
-                globals.push_back(std::make_unique<macro_param_variable>(*value, std::vector<context::A_t> {}));
+                globals.emplace_back(value.get());
             else
-                scope_vars.push_back(std::make_unique<macro_param_variable>(*value, std::vector<context::A_t> {}));
-            // fetch all vars
+                scope_vars.emplace_back(value.get());
         }
 
         for (const auto& it : ctx_->ord_ctx.symbols())
             if (const auto* sym = std::get_if<context::symbol>(&it.second))
-                ordinary_symbols.push_back(std::make_unique<ordinary_symbol_variable>(*sym));
+                ordinary_symbols.emplace_back(sym);
 
-        constexpr auto compare_variables = [](const variable_ptr& l, const variable_ptr& r) {
-            return l->get_name() < r->get_name();
+        const auto add = [this](std::string name, std::vector<scope_entry> entries) {
+            const auto count = entries.size();
+            scopes_.emplace_back(std::move(name), add_scope(std::move(entries)), source(opencode_source_uri_), count);
         };
-
-        std::sort(globals.begin(), globals.end(), compare_variables);
-        std::sort(scope_vars.begin(), scope_vars.end(), compare_variables);
-        std::sort(ordinary_symbols.begin(), ordinary_symbols.end(), compare_variables);
-
-        scopes_.emplace_back("Globals", add_variable(std::move(globals)), source(opencode_source_uri_));
-        scopes_.emplace_back("Locals", add_variable(std::move(scope_vars)), source(opencode_source_uri_));
-        scopes_.emplace_back(
-            "Ordinary symbols", add_variable(std::move(ordinary_symbols)), source(opencode_source_uri_));
+        add("Globals", std::move(globals));
+        add("Locals", std::move(scope_vars));
+        add("Ordinary symbols", std::move(ordinary_symbols));
 
         return scopes_;
     }
 
-    const hlasm_plugin::parser_library::debugging::variable_store& variables(var_reference_t var_ref)
+    // returns variables [start, start + count), zero count means all the remaining ones
+    std::span<const variable_ptr> variables(var_reference_t var_ref, size_t start, size_t count)
     {
-        static const hlasm_plugin::parser_library::debugging::variable_store empty_variables;
-
         if (debug_ended_)
-            return empty_variables;
-        auto it = variables_.find(var_ref);
-        if (it == variables_.end())
-            return empty_variables;
-        for (const auto& var : it->second.variables)
+            return {};
+
+        const auto page = [start, count](size_t size) {
+            const auto first = std::min(start, size);
+            const auto last = count == 0 ? size : first + std::min(count, size - first);
+            return std::make_pair(first, last);
+        };
+
+        if (auto it = variables_.find(var_ref); it != variables_.end())
         {
-            if (var->is_scalar())
-                continue;
+            const auto [first, last] = page(it->second.size());
+            const auto result = std::span<const variable_ptr>(it->second).subspan(first, last - first);
+            prepare_children(result);
+            return result;
+        }
 
-            var->var_reference = add_variable(var->values());
+        auto it = lazy_scopes_.find(var_ref);
+        if (it == lazy_scopes_.end())
+            return {};
+
+        auto& [entries, vars, sorted] = it->second;
+        if (!sorted)
+        {
+            std::ranges::sort(entries, {}, entry_name);
+            vars.resize(entries.size());
+            sorted = true;
         }
 
-        return it->second;
+        const auto [first, last] = page(entries.size());
+        for (auto i = first; i < last; ++i)
+            if (!vars[i])
+                vars[i] = create_variable(entries[i]);
+
+        const auto result = std::span<const variable_ptr>(vars).subspan(first, last - first);
+        prepare_children(result);
+        return result;
     }
 
     void breakpoints(const utils::resource::resource_location& source, std::vector<breakpoint> bps)
@@ -519,10 +595,10 @@ scopes_t debugger::scopes(frame_id_t frame_id) const
     const auto& s = pimpl->scopes(frame_id);
     return scopes_t(s.data(), s.size());
 }
-variables_t debugger::variables(var_reference_t var_ref) const
+variables_t debugger::variables(var_reference_t var_ref, size_t start, size_t count) const
 {
-    const auto& v = pimpl->variables(var_ref);
-    return variables_t(&v, v.variables.size());
+    const auto v = pimpl->variables(var_ref, start, count);
+    return variables_t(v.data(), v.size());
 }
 
 } // namespace hlasm_plugin::parser_library::debugging
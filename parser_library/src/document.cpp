@@ -14,17 +14,31 @@
 
 #include "document.h"
 
-#include <numeric>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <limits>
 
 namespace hlasm_plugin::parser_library {
+
+document_line::document_line(const document_line_view& l)
+{
+    if (const auto lineno = l.lineno(); lineno.has_value())
+        m_line = original_line { l.text(), *lineno };
+    else
+        m_line = replaced_line { std::string(l.text()) };
+}
+
 document::document(std::string_view text)
 {
+    assert(text.size() < std::numeric_limits<uint32_t>::max());
+
     if (text.empty())
     {
-        m_lines.emplace_back(original_line());
+        m_lines.emplace_back(document_line_view(text, 0));
         return;
     }
-    size_t line_no = 0;
+    uint32_t line_no = 0;
     while (!text.empty())
     {
         auto p = text.find_first_of("\r\n");
@@ -33,35 +47,94 @@ document::document(std::string_view text)
         if (text.substr(p, 2) == "\r\n")
             ++p;
 
-        m_lines.emplace_back(original_line { text.substr(0, p + 1), line_no });
+        m_lines.emplace_back(document_line_view(text.substr(0, p + 1), line_no));
 
         text.remove_prefix(p + 1);
         ++line_no;
     }
     if (!text.empty())
-        m_lines.emplace_back(original_line { text, line_no });
+        m_lines.emplace_back(document_line_view(text, line_no));
+}
+
+document::document(std::vector<document_line> lines)
+{
+    m_lines.reserve(lines.size());
+
+    for (const auto& l : lines)
+    {
+        if (!l.is_original())
+            m_replaced_text_size += l.text().size();
+    }
+    m_replaced_text = std::make_unique<char[]>(m_replaced_text_size);
+
+    char* next = m_replaced_text.get();
+    for (const auto& l : lines)
+    {
+        const auto t = l.text();
+        assert(t.size() < std::numeric_limits<uint32_t>::max());
+        if (const auto lineno = l.lineno(); lineno.has_value())
+        {
+            assert(*lineno < document_line_view::replaced_lineno);
+            m_lines.emplace_back(document_line_view(t, (uint32_t)*lineno));
+        }
+        else
+        {
+            std::memcpy(next, t.data(), t.size());
+            m_lines.emplace_back(
+                document_line_view(std::string_view(next, t.size()), document_line_view::replaced_lineno));
+            next += t.size();
+        }
+    }
+}
+
+document::document(const document& d)
+    : m_lines(d.m_lines)
+    , m_replaced_text(std::make_unique<char[]>(d.m_replaced_text_size))
+    , m_replaced_text_size(d.m_replaced_text_size)
+{
+    if (!m_replaced_text_size)
+        return;
+
+    std::memcpy(m_replaced_text.get(), d.m_replaced_text.get(), m_replaced_text_size);
+
+    const auto* const old_begin = d.m_replaced_text.get();
+    const auto* const old_end = old_begin + m_replaced_text_size;
+    for (auto& l : m_lines)
+    {
+        if (std::less_equal()(old_begin, l.m_text) && std::less()(l.m_text, old_end))
+            l.m_text = m_replaced_text.get() + (l.m_text - old_begin);
+    }
+}
+
+document& document::operator=(const document& d)
+{
+    if (this != &d)
+        *this = document(d);
+    return *this;
 }
 
 std::string document::text() const
 {
-    return std::accumulate(m_lines.begin(), m_lines.end(), std::string(), [](std::string&& result, const auto& l) {
+    size_t total = 0;
+    for (const auto& l : m_lines)
+        total += l.text().size() + 1;
+
+    std::string result;
+    result.reserve(total);
+    for (const auto& l : m_lines)
+    {
         auto t = l.text();
         result.append(t);
         if (t.empty() || t.back() != '\n')
             result.push_back('\n');
-        return std::move(result);
-    });
+    }
+    return result;
 }
 
-void document::convert_to_replaced()
+void document::convert_to_replaced() noexcept
 {
     for (auto& line : m_lines)
-    {
-        if (line.is_original())
-        {
-            line = document_line(replaced_line { std::string(line.text()) });
-        }
-    }
+        line.m_lineno = document_line_view::replaced_lineno;
 }
 
 } // namespace hlasm_plugin::parser_library
@@ -15,6 +15,8 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_DOCUMENT_H
 #define HLASMPLUGIN_PARSERLIBRARY_DOCUMENT_H
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -24,6 +26,39 @@
 
 namespace hlasm_plugin::parser_library {
 
+// Compact view of a single document line, the text is owned either by the document or by the analyzed source
+class document_line_view
+{
+    static constexpr uint32_t replaced_lineno = (uint32_t)-1;
+
+    const char* m_text;
+    uint32_t m_length;
+    uint32_t m_lineno;
+
+    friend class document;
+
+    document_line_view(std::string_view text, uint32_t lineno) noexcept
+        : m_text(text.data())
+        , m_length((uint32_t)text.size())
+        , m_lineno(lineno)
+    {}
+
+public:
+    std::string_view text() const noexcept { return std::string_view(m_text, m_length); }
+
+    std::optional<size_t> lineno() const noexcept
+    {
+        if (m_lineno != replaced_lineno)
+            return m_lineno;
+        else
+            return std::nullopt;
+    }
+
+    bool is_original() const noexcept { return m_lineno != replaced_lineno; }
+
+    bool same_type(const document_line_view& d) const noexcept { return is_original() == d.is_original(); }
+};
+
 struct replaced_line
 {
     std::string m_text;
@@ -46,6 +81,7 @@ public:
     explicit document_line(replaced_line l) noexcept
         : m_line(std::move(l))
     {}
+    explicit document_line(const document_line_view& l);
 
     std::string_view text() const noexcept
     {
@@ -65,19 +101,26 @@ public:
     bool same_type(const document_line& d) const noexcept { return m_line.index() == d.m_line.index(); }
 };
 
+// Original lines are views into the analyzed source, the text of all replaced lines is kept in a single buffer
 class document
 {
-    std::vector<document_line> m_lines;
+    std::vector<document_line_view> m_lines;
+    std::unique_ptr<char[]> m_replaced_text;
+    size_t m_replaced_text_size = 0;
 
 public:
-    using iterator = std::vector<document_line>::const_iterator;
-    using const_iterator = std::vector<document_line>::const_iterator;
+    using iterator = std::vector<document_line_view>::const_iterator;
+    using const_iterator = std::vector<document_line_view>::const_iterator;
 
     document() = default;
     explicit document(std::string_view text);
-    explicit document(std::vector<document_line> lines) noexcept
-        : m_lines(std::move(lines))
-    {}
+    explicit document(std::vector<document_line> lines);
+
+    document(const document&);
+    document(document&&) noexcept = default;
+    document& operator=(const document&);
+    document& operator=(document&&) noexcept = default;
+    ~document() = default;
 
     auto begin() const { return m_lines.begin(); }
 
@@ -89,7 +132,8 @@ public:
 
     const auto& at(size_t idx) const { return m_lines.at(idx); }
 
-    void convert_to_replaced();
+    // the lines keep referencing the same text, which therefore has to outlive the document
+    void convert_to_replaced() noexcept;
 };
 
 } // namespace hlasm_plugin::parser_library
@@ -459,7 +459,10 @@ long long data_definition::evaluate_total_length(
     else
         assert(false);
 
-    auto result = dd_type->get_length(dupl, len, evaluate_reduced_nominal_value());
+    if (!nominal_length_cache)
+        nominal_length_cache = dd_type->summarize_nominal(evaluate_reduced_nominal_value());
+
+    auto result = dd_type->get_length(dupl, len, *nominal_length_cache);
     return result >= ((1ll << 31) - 1) * 8 ? -1 : (long long)result;
 }
 
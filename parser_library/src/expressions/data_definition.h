@@ -65,6 +65,10 @@ struct data_definition final : public context::dependable
     range type_range;
     range extension_range;
 
+    // the nominal value does not change, so its part of the length is computed only once, even when the statement
+    // is reused by many macro invocations
+    mutable std::optional<checking::nominal_length_summary> nominal_length_cache;
+
     // Returns conjunction of all dependencies of all expression in data_definition.
     context::dependency_collector get_dependencies(context::dependency_solver& solver) const override;
     // Returns conjunction of dependencies of length modifier and duplication factor, which are the only ones
@@ -44,6 +44,8 @@ public:
     size_t hash() const override;
 
     mach_expr_ptr clone() const override;
+
+    bool symbolic_only() const override { return true; }
 };
 
 // Represents a literal expression (e.g. =C'text')
@@ -153,6 +155,8 @@ public:
     size_t hash() const override;
 
     mach_expr_ptr clone() const override;
+
+    bool symbolic_only() const override { return true; }
 };
 
 // Represents a location counter written in a machine expression (the character *)
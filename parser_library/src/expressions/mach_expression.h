@@ -54,6 +54,9 @@ public:
 
     virtual mach_expr_ptr clone() const = 0;
 
+    // the value depends only on constants and ordinary symbols, so it can be reused within an evaluation epoch
+    virtual bool symbolic_only() const { return false; }
+
     range get_range() const;
     virtual ~mach_expression() = default;
 
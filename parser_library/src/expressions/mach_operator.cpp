@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "context/ordinary_assembly/symbol_value.h"
+#include "protocol.h"
 #include "utils/general_hashers.h"
 #include "utils/similar.h"
 
@@ -91,21 +92,21 @@ size_t mach_expr_unary<par>::hash() const
 }
 
 template<>
-mach_expression::value_t mach_expr_binary<add>::evaluate(
+mach_expression::value_t mach_expr_binary<add>::evaluate_operator(
     context::dependency_solver& info, diagnostic_op_consumer& diags) const
 {
     return left_->evaluate(info, diags) + right_->evaluate(info, diags);
 }
 
 template<>
-mach_expression::value_t mach_expr_binary<sub>::evaluate(
+mach_expression::value_t mach_expr_binary<sub>::evaluate_operator(
     context::dependency_solver& info, diagnostic_op_consumer& diags) const
 {
     return left_->evaluate(info, diags) - right_->evaluate(info, diags);
 }
 
 template<>
-mach_expression::value_t mach_expr_binary<rel_addr>::evaluate(
+mach_expression::value_t mach_expr_binary<rel_addr>::evaluate_operator(
     context::dependency_solver& info, diagnostic_op_consumer& diags) const
 {
     auto location = left_->evaluate(info, diags);
@@ -141,7 +142,7 @@ mach_expression::value_t mach_expr_binary<rel_addr>::evaluate(
 }
 
 template<>
-mach_expression::value_t mach_expr_binary<mul>::evaluate(
+mach_expression::value_t mach_expr_binary<mul>::evaluate_operator(
     context::dependency_solver& info, diagnostic_op_consumer& diags) const
 {
     auto left_res = left_->evaluate(info, diags);
@@ -158,7 +159,7 @@ mach_expression::value_t mach_expr_binary<mul>::evaluate(
 }
 
 template<>
-mach_expression::value_t mach_expr_binary<div>::evaluate(
+mach_expression::value_t mach_expr_binary<div>::evaluate_operator(
     context::dependency_solver& info, diagnostic_op_consumer& diags) const
 {
     auto left_res = left_->evaluate(info, diags);
@@ -173,6 +174,49 @@ mach_expression::value_t mach_expr_binary<div>::evaluate(
     return left_res / right_res;
 }
 
+template<typename T>
+mach_expression::value_t mach_expr_binary<T>::evaluate(
+    context::dependency_solver& info, diagnostic_op_consumer& diags) const
+{
+    const auto* epoch = symbolic_only_ ? info.get_evaluation_epoch() : nullptr;
+    if (!epoch)
+        return evaluate_operator(info, diags);
+
+    if (memo_epoch_ == epoch->id)
+    {
+        ++epoch->metrics->mach_evaluation_cache_hits;
+        return memo_value_;
+    }
+    ++epoch->metrics->mach_evaluation_cache_misses;
+
+    bool diagnosed = false;
+    diagnostic_consumer_transform tracking_diags([&diags, &diagnosed](diagnostic_op d) {
+        diagnosed = true;
+        diags.add_diagnostic(std::move(d));
+    });
+    auto result = evaluate_operator(info, tracking_diags);
+
+    // undefined symbols may still get defined and relocatable values change with the layout
+    if (!diagnosed && result.value_kind() == context::symbol_value_kind::ABS)
+    {
+        memo_epoch_ = epoch->id;
+        memo_value_ = result.get_abs();
+    }
+
+    return result;
+}
+
+template mach_expression::value_t mach_expr_binary<add>::evaluate(
+    context::dependency_solver& info, diagnostic_op_consumer& diags) const;
+template mach_expression::value_t mach_expr_binary<sub>::evaluate(
+    context::dependency_solver& info, diagnostic_op_consumer& diags) const;
+template mach_expression::value_t mach_expr_binary<rel_addr>::evaluate(
+    context::dependency_solver& info, diagnostic_op_consumer& diags) const;
+template mach_expression::value_t mach_expr_binary<mul>::evaluate(
+    context::dependency_solver& info, diagnostic_op_consumer& diags) const;
+template mach_expression::value_t mach_expr_binary<div>::evaluate(
+    context::dependency_solver& info, diagnostic_op_consumer& diags) const;
+
 template<>
 mach_expression::value_t mach_expr_unary<add>::evaluate(
     context::dependency_solver& info, diagnostic_op_consumer& diags) const
@@ -18,6 +18,9 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_MACH_OPERATOR_H
 #define HLASMPLUGIN_PARSERLIBRARY_MACH_OPERATOR_H
 
+#include <cstddef>
+#include <cstdint>
+
 #include "mach_expression.h"
 
 namespace hlasm_plugin::parser_library::expressions {
@@ -32,12 +35,20 @@ class mach_expr_binary final : public mach_expression
 
     mach_expr_ptr left_;
     mach_expr_ptr right_;
+    bool symbolic_only_;
+    // absolute value of a symbolic only operator remains valid for the whole evaluation epoch,
+    // because defined symbols never change
+    mutable size_t memo_epoch_ = 0;
+    mutable std::int32_t memo_value_ = 0;
+
+    value_t evaluate_operator(context::dependency_solver& info, diagnostic_op_consumer& diags) const;
 
 public:
     mach_expr_binary(mach_expr_ptr left, mach_expr_ptr right, range rng)
         : mach_expression(rng)
         , left_(assign_expr(std::move(left), rng))
         , right_(assign_expr(std::move(right), rng))
+        , symbolic_only_(left_->symbolic_only() && right_->symbolic_only())
     {
         // text = left_->move_text() + T::sign_char() + right_->move_text();
     }
@@ -61,6 +72,8 @@ public:
         return std::make_unique<mach_expr_binary<T>>(left_->clone(), right_->clone(), get_range());
     }
 
+    bool symbolic_only() const override { return symbolic_only_; }
+
     const mach_expression* left_expression() const { return left_.get(); }
     const mach_expression* right_expression() const { return right_.get(); }
 };
@@ -74,11 +87,13 @@ class mach_expr_unary final : public mach_expression
     bool do_is_similar(const mach_expression& expr) const override;
 
     mach_expr_ptr child_;
+    bool symbolic_only_;
 
 public:
     mach_expr_unary(mach_expr_ptr child, range rng)
         : mach_expression(rng)
         , child_(assign_expr(std::move(child), rng))
+        , symbolic_only_(child_->symbolic_only())
     {
         // text = T::sign_char_begin() + child_->move_text() + T::sign_char_end();
     }
@@ -94,6 +109,8 @@ public:
     size_t hash() const override;
 
     mach_expr_ptr clone() const override { return std::make_unique<mach_expr_unary<T>>(child_->clone(), get_range()); }
+
+    bool symbolic_only() const override { return symbolic_only_; }
 };
 
 struct add
@@ -25,6 +25,8 @@ lib_config lib_config::make_default()
 {
     lib_config def_config;
     def_config.diag_supress_limit = 10;
+    def_config.macro_trace_events = 0;
+    def_config.fast_syntax_diagnostics = false;
 
     return def_config;
 }
@@ -41,6 +43,18 @@ lib_config lib_config::load_from_json(const nlohmann::json& config)
             loaded.diag_supress_limit = 0;
     }
 
+    found = config.find("macroTraceEvents");
+    if (found != config.end())
+    {
+        loaded.macro_trace_events = found->get<int64_t>();
+        if (loaded.macro_trace_events < 0)
+            loaded.macro_trace_events = 0;
+    }
+
+    found = config.find("fastSyntaxDiagnostics");
+    if (found != config.end() && found->is_boolean())
+        loaded.fast_syntax_diagnostics = found->get<bool>();
+
 
     return loaded;
 }
@@ -65,12 +79,17 @@ lib_config lib_config::combine_two_configs(const lib_config& second) const
     lib_config combined(*this);
     if (!combined.diag_supress_limit.has_value())
         combined.diag_supress_limit = second.diag_supress_limit;
+    if (!combined.macro_trace_events.has_value())
+        combined.macro_trace_events = second.macro_trace_events;
+    if (!combined.fast_syntax_diagnostics.has_value())
+        combined.fast_syntax_diagnostics = second.fast_syntax_diagnostics;
     return combined;
 }
 
 bool operator==(const lib_config& lhs, const lib_config& rhs)
 {
-    return lhs.diag_supress_limit == rhs.diag_supress_limit;
+    return lhs.diag_supress_limit == rhs.diag_supress_limit && lhs.macro_trace_events == rhs.macro_trace_events
+        && lhs.fast_syntax_diagnostics == rhs.fast_syntax_diagnostics;
 }
 
 } // namespace hlasm_plugin::parser_library
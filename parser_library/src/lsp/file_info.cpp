@@ -168,9 +168,9 @@ void file_info::update_occurrences(const std::vector<symbol_occurrence>& occurre
         line_details.begin(),
         [](const auto& o, const auto& n) {
             return lsp::line_occurence_details {
-                std::max(o.max_endline, n.max_endline),
                 o.active_using ? o.active_using : n.active_using,
                 o.active_section ? o.active_section : n.active_section,
+                std::max(o.max_endline, n.max_endline),
                 o.active_using && n.active_using && o.active_using != n.active_using,
                 o.active_section && n.active_section && o.active_section != n.active_section,
                 o.branches_up || n.branches_up,
@@ -243,7 +243,7 @@ void file_info::process_occurrences()
 
     auto m = (size_t)-1;
     std::transform(occurrences.rbegin(), occurrences.rend(), occurrences_start_limit.rbegin(), [&m](const auto& occ) {
-        return m = std::min(m, occ.occurrence_range.start.line);
+        return m = std::min(m, (size_t)occ.occurrence_range.start.line);
     });
 }
 
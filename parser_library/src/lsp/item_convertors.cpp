@@ -250,6 +250,13 @@ std::string get_macro_documentation(const text_data_view& text, size_t definitio
     return result;
 }
 
+const std::string& get_macro_documentation(const macro_info& macro, const text_data_view& macro_text)
+{
+    if (!macro.documentation)
+        macro.documentation = get_macro_documentation(macro_text, macro.definition_location.pos.line);
+    return *macro.documentation;
+}
+
 std::string get_logical_line(const text_data_view& text, size_t definition_line)
 {
     size_t end_line = definition_line;
@@ -297,7 +304,7 @@ completion_item_s generate_completion_item(const macro_info& sym, const file_inf
     return completion_item_s(m.id.to_string(),
         get_macro_signature(m),
         m.id.to_string(),
-        info ? get_macro_documentation(info->data, sym.definition_location.pos.line) : "",
+        info ? get_macro_documentation(sym, info->data) : "",
         completion_item_kind::macro);
 }
 
@@ -46,6 +46,7 @@ std::string hover_text(const variable_symbol_definition& sym);
 std::string hover_text(std::span<const context::using_context_description> usings);
 void append_hover_text(std::string& buffer, const context::using_context_description& u);
 std::string get_macro_documentation(const text_data_view& macro_text, size_t definition_line);
+const std::string& get_macro_documentation(const macro_info& macro, const text_data_view& macro_text);
 std::string get_logical_line(const text_data_view& text, size_t definition_line);
 std::string get_macro_signature(const context::macro_definition& m);
 bool is_continued_line(std::string_view line);
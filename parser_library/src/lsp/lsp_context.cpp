@@ -973,7 +973,7 @@ std::string lsp_context::hover_for_macro(const macro_info& macro) const
     if (mit == m_files.end())
         return "";
 
-    return get_macro_documentation(mit->second->data, macro.definition_location.pos.line);
+    return get_macro_documentation(macro, mit->second->data);
 }
 std::string lsp_context::hover_for_instruction(context::id_index name) const
 {
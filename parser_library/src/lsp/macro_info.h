@@ -15,6 +15,9 @@
 #ifndef LSP_MACRO_INFO_H
 #define LSP_MACRO_INFO_H
 
+#include <cstdint>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "context/macro.h"
@@ -113,9 +116,9 @@ using file_scopes_t = std::unordered_map<utils::resource::resource_location,
 
 struct line_occurence_details
 {
-    size_t max_endline = 0;
     index_t<context::using_collection> active_using;
     const context::section* active_section = nullptr;
+    std::uint32_t max_endline = 0;
     bool using_overflow : 1 = false;
     bool section_overflow : 1 = false;
     bool branches_up : 1 = false;
@@ -138,6 +141,8 @@ struct macro_info
     vardef_storage var_definitions;
     file_scopes_t file_scopes_;
     file_occurrences_t file_occurrences_;
+    // documentation extracted from the definition file on first use, the file content is fixed for the definition
+    mutable std::optional<std::string> documentation;
 
     macro_info(bool external,
         location definition_location,
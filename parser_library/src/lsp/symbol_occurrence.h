@@ -15,6 +15,7 @@
 #ifndef LSP_SYMBOL_OCCURRENCE_H
 #define LSP_SYMBOL_OCCURRENCE_H
 
+#include <cstdint>
 #include <vector>
 
 #include "context/id_storage.h"
@@ -45,28 +46,65 @@ constexpr occurrence_kind operator&(occurrence_kind l, occurrence_kind r) noexce
 
 constexpr bool any(occurrence_kind e) { return e != occurrence_kind(); }
 
+// position with 32-bit members, lines and columns never exceed position::max_value
+struct compact_position
+{
+    std::uint32_t line = 0;
+    std::uint32_t column = 0;
+
+    constexpr compact_position() = default;
+    constexpr compact_position(const position& p) noexcept
+        : line(static_cast<std::uint32_t>(p.line))
+        , column(static_cast<std::uint32_t>(p.column))
+    {}
+
+    constexpr operator position() const noexcept { return position(line, column); }
+
+    auto operator<=>(const compact_position&) const noexcept = default;
+    bool operator==(const position& p) const noexcept { return line == p.line && column == p.column; }
+};
+
+// range stored in half the space of the regular one, occurrences are kept for every file of a workspace
+struct compact_range
+{
+    compact_position start;
+    compact_position end;
+
+    constexpr compact_range() = default;
+    constexpr compact_range(const range& r) noexcept
+        : start(r.start)
+        , end(r.end)
+    {}
+
+    operator range() const noexcept { return range(start, end); }
+
+    bool operator==(const compact_range&) const noexcept = default;
+    bool operator==(const range& r) const noexcept { return start == r.start && end == r.end; }
+};
+
 struct symbol_occurrence
 {
-    occurrence_kind kind;
-    bool evaluated_model = false;
     context::id_index name;
-    range occurrence_range;
+    compact_range occurrence_range;
 
     // in case of INSTR kind, holds potential macro opcode
     const context::macro_definition* opcode = nullptr;
 
+    occurrence_kind kind;
+    bool evaluated_model = false;
+
     symbol_occurrence(occurrence_kind kind, context::id_index name, const range& occurrence_range, bool evaluated_model)
-        : kind(kind)
-        , evaluated_model(evaluated_model)
-        , name(name)
+        : name(name)
         , occurrence_range(occurrence_range)
+        , kind(kind)
+        , evaluated_model(evaluated_model)
     {}
 
     symbol_occurrence(context::id_index name, const context::macro_definition* opcode, const range& occurrence_range)
-        : kind(occurrence_kind::INSTR)
-        , name(name)
+        : name(name)
         , occurrence_range(occurrence_range)
         , opcode(opcode)
+        , kind(occurrence_kind::INSTR)
     {}
 
     // returns true, if this occurrence kind depends on a scope
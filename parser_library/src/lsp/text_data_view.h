@@ -15,21 +15,28 @@
 #ifndef LSP_TEXT_DATA_VIEW_H
 #define LSP_TEXT_DATA_VIEW_H
 
+#include <memory>
 #include <string_view>
 #include <vector>
 
 #include "range.h"
 
+namespace hlasm_plugin::parser_library::workspaces {
+struct text_buffer;
+} // namespace hlasm_plugin::parser_library::workspaces
+
 namespace hlasm_plugin::parser_library::lsp {
 
 class text_data_view
 {
     std::string_view text;
-    std::vector<size_t> line_indices;
+    std::shared_ptr<const std::vector<size_t>> line_indices;
 
 public:
-    text_data_view() = default;
+    text_data_view();
     explicit text_data_view(std::string_view text);
+    // shares the text and the line indices of the buffer and keeps it alive
+    explicit text_data_view(std::shared_ptr<const workspaces::text_buffer> buffer);
 
     // Returns a specified line from the text, zero-based indexed.
     // If the line does not exist, returns empty string view
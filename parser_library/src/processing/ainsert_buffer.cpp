@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "ainsert_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+namespace hlasm_plugin::parser_library::processing {
+
+ainsert_buffer::record ainsert_buffer::store(std::string_view rec)
+{
+    if (rec.empty())
+        return { {}, no_chunk };
+
+    if (m_chunks.empty() || m_chunks.back().size - m_chunks.back().used < rec.size())
+    {
+        if (!m_chunks.empty() && m_chunks.back().live_records == 0)
+        {
+            recycle(m_chunks.back());
+            m_chunks.pop_back();
+        }
+        if (m_spare.data && m_spare.size >= rec.size())
+            m_chunks.push_back(std::exchange(m_spare, {}));
+        else
+        {
+            const auto size = std::max(chunk_size, rec.size());
+            m_chunks.push_back({ std::make_unique<char[]>(size), size });
+        }
+    }
+
+    auto& c = m_chunks.back();
+    char* const dst = c.data.get() + c.used;
+    std::memcpy(dst, rec.data(), rec.size());
+    c.used += rec.size();
+    ++c.live_records;
+
+    return { std::string_view(dst, rec.size()), m_first_chunk_id + m_chunks.size() - 1 };
+}
+
+void ainsert_buffer::recycle(chunk& c)
+{
+    // keep a single chunk for reuse, generator macros usually insert in bursts
+    c.used = 0;
+    c.live_records = 0;
+    if (!m_spare.data && c.size == chunk_size)
+        m_spare = std::exchange(c, {});
+    else
+        c = {};
+}
+
+void ainsert_buffer::release(size_t chunk_id)
+{
+    if (chunk_id == no_chunk)
+        return;
+
+    auto& c = m_chunks[chunk_id - m_first_chunk_id];
+    if (--c.live_records > 0)
+        return;
+
+    if (&c == &m_chunks.back())
+    {
+        c.used = 0;
+        return;
+    }
+
+    recycle(c);
+
+    while (!m_chunks.front().data)
+    {
+        m_chunks.pop_front();
+        ++m_first_chunk_id;
+    }
+}
+
+void ainsert_buffer::release_all()
+{
+    // keep one chunk around
+    if (m_chunks.empty() && m_spare.data)
+        m_chunks.push_back(std::exchange(m_spare, {}));
+    m_spare = {};
+    if (m_chunks.size() > 1)
+        m_chunks.erase(m_chunks.begin(), std::prev(m_chunks.end()));
+    if (!m_chunks.empty())
+    {
+        m_chunks.front().used = 0;
+        m_chunks.front().live_records = 0;
+    }
+    m_first_chunk_id = 0;
+}
+
+void ainsert_buffer::pop_front()
+{
+    const auto chunk_id = m_records.front().chunk_id;
+    m_records.pop_front();
+    if (m_records.empty())
+        release_all();
+    else
+        release(chunk_id);
+}
+
+size_t ainsert_buffer::allocated_chunks() const
+{
+    return std::ranges::count_if(m_chunks, [](const auto& c) { return !!c.data; }) + !!m_spare.data;
+}
+
+size_t ainsert_buffer::joined_size() const
+{
+    size_t result = 0;
+    for (const auto& r : m_records)
+        result += r.text.size() + 1;
+    return result;
+}
+
+void ainsert_buffer::clear()
+{
+    m_records.clear();
+    release_all();
+}
+
+std::string make_padded_record(std::string_view rec, size_t len)
+{
+    std::string result(len, ' ');
+    std::memcpy(result.data(), rec.data(), std::min(rec.size(), len));
+    return result;
+}
+
+} // namespace hlasm_plugin::parser_library::processing
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef PROCESSING_AINSERT_BUFFER_H
+#define PROCESSING_AINSERT_BUFFER_H
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+namespace hlasm_plugin::parser_library::processing {
+
+// Stores AINSERT records in large append-only chunks and keeps only views in the queue.
+// Each chunk counts the records still queued in it and is released (or kept for reuse) once all of them are popped.
+class ainsert_buffer
+{
+    struct chunk
+    {
+        std::unique_ptr<char[]> data;
+        size_t size = 0;
+        size_t used = 0;
+        size_t live_records = 0;
+    };
+
+    struct record
+    {
+        std::string_view text;
+        size_t chunk_id;
+    };
+    static constexpr size_t no_chunk = (size_t)-1;
+
+    // the last chunk is being filled, chunk ids are positions offset by m_first_chunk_id
+    std::deque<chunk> m_chunks;
+    size_t m_first_chunk_id = 0;
+    chunk m_spare;
+
+    std::deque<record> m_records;
+
+    record store(std::string_view rec);
+    void recycle(chunk& c);
+    void release(size_t chunk_id);
+    void release_all();
+
+public:
+    static constexpr size_t chunk_size = 64 * 1024;
+
+    void push_back(std::string_view rec) { m_records.push_back(store(rec)); }
+    void push_front(std::string_view rec) { m_records.push_front(store(rec)); }
+
+    // the view is valid until the next pop_front or clear
+    std::string_view front() const { return m_records.front().text; }
+    void pop_front();
+
+    bool empty() const { return m_records.empty(); }
+    size_t size() const { return m_records.size(); }
+
+    auto records() const { return std::views::transform(m_records, &record::text); }
+
+    // total length of all records, including a separator after each of them
+    size_t joined_size() const;
+
+    void clear();
+
+    size_t allocated_chunks() const;
+};
+
+// copies the record into a string padded (or truncated) to the requested length with a single allocation
+std::string make_padded_record(std::string_view rec, size_t len);
+
+} // namespace hlasm_plugin::parser_library::processing
+
+#endif
@@ -1127,7 +1127,7 @@ void asm_processor::process_LTORG(rebuilt_statement stmt)
                 context::symbol_attributes(context::symbol_origin::EQU, 'U'_ebcdic, 1));
     }
 
-    hlasm_ctx.ord_ctx.generate_pool(*this, hlasm_ctx.using_current(), lib_info);
+    hlasm_ctx.ord_ctx.generate_pool(*this, hlasm_ctx.using_current(), lib_info).run();
 
     context::ordinary_assembly_dependency_solver dep_solver(hlasm_ctx.ord_ctx, lib_info);
     hlasm_ctx.ord_ctx.symbol_dependencies().add_dependency(
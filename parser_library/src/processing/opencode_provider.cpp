@@ -70,6 +70,7 @@ opencode_provider::~opencode_provider() = default;
 utils::task opencode_provider::start_preprocessor()
 {
     m_input_document = co_await m_preprocessor->generate_replacement(std::move(m_input_document));
+    m_extracted_lines.clear();
 }
 
 void opencode_provider::onetime_action()
@@ -83,6 +84,7 @@ void opencode_provider::rewind_input(context::source_position pos)
     m_ainsert_buffer.clear(); // this needs to be tested, but apparently AGO clears AINSERT buffer
     assert(pos.rewind_target <= m_input_document.size());
     m_next_line_index = pos.rewind_target;
+    m_keep_extracted_lines = true;
 }
 
 void opencode_provider::generate_aread_highlighting(std::string_view text, size_t line_no) const
@@ -108,9 +110,8 @@ std::variant<std::string, utils::value_task<std::string>> opencode_provider::are
 {
     if (!m_ainsert_buffer.empty())
     {
-        auto result = std::move(m_ainsert_buffer.front());
+        auto result = make_padded_record(m_ainsert_buffer.front(), 80);
         m_ainsert_buffer.pop_front();
-        result.resize(80, ' ');
         return result;
     }
 
@@ -145,7 +146,7 @@ std::string opencode_provider::aread_from_copybook() const
     const auto line = copy.suspended_at;
     std::string_view remaining_text = m_ctx->lsp_ctx->get_file_info(copy.definition_location()->resource_loc)
                                           ->data.get_lines_beginning_at({ line, 0 });
-    std::string result(lexing::extract_line(remaining_text).first);
+    auto result = make_padded_record(lexing::extract_line(remaining_text).first, 80);
     if (remaining_text.empty())
         copy.resume();
     else
@@ -154,8 +155,6 @@ std::string opencode_provider::aread_from_copybook() const
     while (!opencode_stack.empty() && !opencode_stack.back().suspended())
         opencode_stack.pop_back();
 
-    result.resize(80, ' ');
-
     return result;
 }
 std::string opencode_provider::try_aread_from_document()
@@ -165,19 +164,17 @@ std::string opencode_provider::try_aread_from_document()
 
     const auto& line = m_input_document.at(m_next_line_index++);
     auto line_text = line.text();
-    std::string result(lexing::extract_line(line_text).first);
+    const auto text = lexing::extract_line(line_text).first;
     if (auto lineno = line.lineno(); lineno.has_value())
     {
-        m_processing_manager.aread_cb(*lineno, result);
-        generate_aread_highlighting(result, *lineno);
+        m_processing_manager.aread_cb(*lineno, text);
+        generate_aread_highlighting(text, *lineno);
     }
 
-    result.resize(80, ' ');
-
-    return result;
+    return make_padded_record(text, 80);
 }
 
-void opencode_provider::ainsert(const std::string& rec, ainsert_destination dest)
+void opencode_provider::ainsert(std::string_view rec, ainsert_destination dest)
 {
     switch (dest)
     {
@@ -623,8 +620,8 @@ bool opencode_provider::suspend_copy_processing(remove_empty re) const
 utils::task opencode_provider::convert_ainsert_buffer_to_copybook()
 {
     std::string result;
-    result.reserve(m_ainsert_buffer.size() * (80 + 1));
-    for (const auto& s : m_ainsert_buffer)
+    result.reserve(m_ainsert_buffer.joined_size());
+    for (const auto& s : m_ainsert_buffer.records())
         result.append(s).push_back('\n');
     m_ainsert_buffer.clear();
 
@@ -656,6 +653,9 @@ context::shared_stmt_ptr opencode_provider::get_next(const statement_processor&
         m_restart_process_ordinary.reset();
         return result;
     }
+    if (proc.kind == processing_kind::LOOKAHEAD)
+        m_keep_extracted_lines = true;
+
     auto ll_res = extract_next_logical_line();
     if (ll_res == extract_next_logical_line_result::failed)
         return nullptr;
@@ -922,6 +922,9 @@ extract_next_logical_line_result opencode_provider::extract_next_logical_line()
         return extract_next_logical_line_result::failed;
     }
 
+    if (reuse_extracted_logical_line())
+        return ictl_allowed ? extract_next_logical_line_result::ictl : extract_next_logical_line_result::normal;
+
     const auto first_index = m_next_line_index;
     const auto current_lineno = m_input_document.at(m_next_line_index).lineno().value();
     while (m_next_line_index < m_input_document.size())
@@ -943,12 +946,49 @@ extract_next_logical_line_result opencode_provider::extract_next_logical_line()
     m_current_logical_line_source.last_index = m_next_line_index;
     m_current_logical_line_source.source = logical_line_origin::source_type::file;
 
+    if (m_keep_extracted_lines)
+        store_extracted_logical_line();
+
     if (ictl_allowed)
         return extract_next_logical_line_result::ictl;
 
     return extract_next_logical_line_result::normal;
 }
 
+bool opencode_provider::reuse_extracted_logical_line()
+{
+    if (m_extracted_lines.empty())
+        return false;
+
+    const auto& e = m_extracted_lines[m_next_line_index % extracted_lines_capacity];
+    if (e.first_index != m_next_line_index)
+        return false;
+
+    m_current_logical_line = e.line;
+
+    m_current_logical_line_source.begin_line = e.begin_line;
+    m_current_logical_line_source.first_index = e.first_index;
+    m_current_logical_line_source.last_index = e.last_index;
+    m_current_logical_line_source.source = logical_line_origin::source_type::file;
+
+    m_next_line_index = e.last_index;
+
+    return true;
+}
+
+void opencode_provider::store_extracted_logical_line()
+{
+    if (m_extracted_lines.empty())
+        m_extracted_lines.resize(extracted_lines_capacity);
+
+    const auto& src = m_current_logical_line_source;
+    auto& e = m_extracted_lines[src.first_index % extracted_lines_capacity];
+    e.first_index = src.first_index;
+    e.last_index = src.last_index;
+    e.begin_line = src.begin_line;
+    e.line = m_current_logical_line;
+}
+
 const parsing::parser_holder& opencode_provider::prepare_operand_parser(const std::string& text,
     context::hlasm_context& hlasm_ctx,
     diagnostic_op_consumer* diags,
@@ -16,7 +16,6 @@
 #define PROCESSING_OPENCODE_PROVIDER_H
 
 #include <concepts>
-#include <deque>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -25,6 +24,7 @@
 #include <variant>
 #include <vector>
 
+#include "ainsert_buffer.h"
 #include "context/source_snapshot.h"
 #include "lexing/logical_line.h"
 #include "parsing/parser_error_listener.h"
@@ -108,7 +108,20 @@ class opencode_provider final : public statement_provider, virtual_file_monitor
         } source;
     } m_current_logical_line_source;
 
-    std::deque<std::string> m_ainsert_buffer;
+    // Logical lines already split from the input document, reused when the input is rewound (open code loops,
+    // lookahead). Direct-mapped by the index of the first line of the statement.
+    struct extracted_logical_line
+    {
+        size_t first_index = (size_t)-1;
+        size_t last_index = 0;
+        size_t begin_line = 0;
+        lexing::logical_line<utils::utf8_iterator<std::string_view::iterator, utils::utf8_utf16_counter>> line;
+    };
+    static constexpr size_t extracted_lines_capacity = 256;
+    std::vector<extracted_logical_line> m_extracted_lines;
+    bool m_keep_extracted_lines = false;
+
+    ainsert_buffer m_ainsert_buffer;
 
     std::shared_ptr<std::unordered_map<context::id_index, std::string>> m_virtual_files;
 
@@ -171,7 +184,7 @@ public:
     // rewinds position in file
     void rewind_input(context::source_position pos);
     [[nodiscard]] std::variant<std::string, utils::value_task<std::string>> aread();
-    void ainsert(const std::string& rec, ainsert_destination dest);
+    void ainsert(std::string_view rec, ainsert_destination dest);
 
     opencode_provider(std::string_view text,
         analyzing_context& ctx,
@@ -206,6 +219,8 @@ private:
     void generate_continuation_error_messages(diagnostic_op_consumer* diags) const;
     extract_next_logical_line_result extract_next_logical_line_from_copy_buffer();
     extract_next_logical_line_result extract_next_logical_line();
+    bool reuse_extracted_logical_line();
+    void store_extracted_logical_line();
 
     const parsing::parser_holder& prepare_operand_parser(const std::string& text,
         context::hlasm_context& hlasm_ctx,
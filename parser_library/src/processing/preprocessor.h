@@ -50,21 +50,26 @@ template<std::move_constructible T>
 class value_task;
 } // namespace hlasm_plugin::utils
 
+namespace hlasm_plugin::parser_library::workspaces {
+struct text_buffer;
+} // namespace hlasm_plugin::parser_library::workspaces
+
 namespace hlasm_plugin::parser_library::processing {
 
+// The fetcher should issue the request for the member when called, the returned task only waits for the result.
 using library_fetcher =
-    std::function<utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>>(
-        std::string)>;
+    std::function<utils::value_task<std::optional<
+        std::pair<std::shared_ptr<const workspaces::text_buffer>, utils::resource::resource_location>>>(std::string)>;
 
 class preprocessor
 {
 public:
-    using line_iterator = std::vector<document_line>::const_iterator;
+    using line_iterator = document::const_iterator;
 
     struct included_member_details
     {
         std::string name;
-        std::string text;
+        std::shared_ptr<const workspaces::text_buffer> text;
         utils::resource::resource_location loc;
     };
 
@@ -46,6 +46,7 @@
 #include "utils/task.h"
 #include "utils/text_matchers.h"
 #include "utils/unicode_text.h"
+#include "workspaces/file.h"
 #include "workspaces/parse_lib_provider.h"
 
 namespace hlasm_plugin::parser_library::processing {
@@ -332,6 +333,7 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
     semantics::source_info_processor& m_src_proc;
     db2_logical_line_helper m_ll_helper;
     db2_logical_line_helper m_ll_include_helper;
+    member_prefetcher m_prefetcher;
 
     enum class line_type
     {
@@ -559,9 +561,10 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
         }
         m_result.emplace_back(replaced_line { "***$$$\n" });
 
-        std::optional<std::pair<std::string, utils::resource::resource_location>> include_member;
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, utils::resource::resource_location>>
+            include_member;
         if (m_libs)
-            include_member = co_await m_libs(member_upper);
+            include_member = co_await m_prefetcher.get(m_libs, member_upper);
         if (!include_member.has_value())
         {
             if (m_diags)
@@ -570,7 +573,7 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
         }
 
         auto& [include_mem_text, include_mem_loc] = *include_member;
-        document d(include_mem_text);
+        document d(include_mem_text->text);
         d.convert_to_replaced();
         co_await generate_replacement(d.begin(), d.end(), m_ll_include_helper, false);
         append_included_member(std::make_unique<included_member_details>(included_member_details {
@@ -597,6 +600,39 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
 
     static bool ignore_line(std::string_view s) { return s.empty() || s.front() == '*' || s.substr(0, 2) == ".*"; }
 
+    // requests members of all single-line INCLUDE statements before the first one is processed
+    void prefetch_members(line_iterator it, line_iterator end)
+    {
+        if (!m_libs)
+            return;
+
+        static const auto include_line =
+            std::regex(R"(^\S*\s+EXEC\s+SQL\s+INCLUDE\s+([^\s-]+)\s*(?:--.*)?$)", std::regex_constants::icase);
+
+        std::vector<std::string> members;
+        bool continued = false;
+        std::match_results<std::string_view::iterator> matches;
+        for (; it != end; ++it)
+        {
+            const auto text = it->text();
+            if (std::exchange(continued, is_continued(text)) || continued)
+                continue;
+
+            const auto line_preview = create_line_preview(text);
+            if (ignore_line(line_preview)
+                || !std::regex_match(line_preview.begin(), line_preview.end(), matches, include_line))
+                continue;
+
+            auto member_upper = utils::to_upper_copy(matches[1].str());
+            if (member_upper == "SQLCA" || member_upper == "SQLDA")
+                continue;
+
+            members.push_back(std::move(member_upper));
+        }
+
+        m_prefetcher.request(m_libs, std::move(members));
+    }
+
     static semantics::preproc_details::name_range extract_label(std::string_view& s, size_t lineno)
     {
         auto label = utils::next_nonblank_sequence(s);
@@ -1017,7 +1053,7 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
                     }))
                 break;
 
-            m_result.push_back(*it);
+            m_result.emplace_back(*it);
         }
     }
 
@@ -1146,6 +1182,9 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
         // ignores ICTL
         inject_SQLSECT();
 
+        m_prefetcher.clear();
+        prefetch_members(it, end);
+
         co_await generate_replacement(it, end, m_ll_helper, true);
 
         if (m_source_translated || !m_conditional)
@@ -31,6 +31,7 @@
 #include "utils/resource_location.h"
 #include "utils/string_operations.h"
 #include "utils/task.h"
+#include "workspaces/file.h"
 
 namespace hlasm_plugin::parser_library::processing {
 
@@ -57,6 +58,12 @@ std::string get_copy_member(const std::match_results<std::string_view::iterator>
 
     return std::string(matches[2].first, matches[2].second);
 }
+
+const std::regex& get_include_regex()
+{
+    static const std::regex include_regex(R"(^(-INC|\+\+INCLUDE)\s+(\S+)(?:\s+(.*))?)");
+    return include_regex;
+}
 } // namespace
 
 class endevor_preprocessor final : public preprocessor
@@ -65,6 +72,32 @@ class endevor_preprocessor final : public preprocessor
     diagnostic_op_consumer* m_diags = nullptr;
     endevor_preprocessor_options m_options;
     semantics::source_info_processor& m_src_proc;
+    member_prefetcher m_prefetcher;
+
+    // all members referenced by the innermost document are requested before the first one is needed
+    void prefetch_members(const std::vector<stack_entry>& stack)
+    {
+        if (!m_libs)
+            return;
+
+        const auto& include_regex = get_include_regex();
+        std::vector<std::string> members;
+        std::match_results<std::string_view::iterator> matches;
+        for (const auto& line : stack.back().doc)
+        {
+            const auto& text = line.text();
+            if (!std::regex_search(text.begin(), text.end(), matches, include_regex))
+                continue;
+
+            auto member_upper = utils::to_upper_copy(get_copy_member(matches));
+            // cycles are diagnosed without fetching the member
+            if (std::none_of(
+                    stack.begin(), stack.end(), [&member_upper](const auto& e) { return e.name == member_upper; }))
+                members.push_back(std::move(member_upper));
+        }
+
+        m_prefetcher.request(m_libs, std::move(members));
+    }
 
     [[nodiscard]] utils::value_task<bool> process_member(std::string member, std::vector<stack_entry>& stack)
     {
@@ -78,9 +111,10 @@ class endevor_preprocessor final : public preprocessor
             co_return false;
         }
 
-        std::optional<std::pair<std::string, utils::resource::resource_location>> library;
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, utils::resource::resource_location>>
+            library;
         if (m_libs)
-            library = co_await m_libs(member_upper);
+            library = co_await m_prefetcher.get(m_libs, member_upper);
 
         if (!library.has_value())
         {
@@ -93,9 +127,10 @@ class endevor_preprocessor final : public preprocessor
         else
         {
             auto& [lib_text, lib_loc] = *library;
-            document member_doc(lib_text);
+            document member_doc(lib_text->text);
             member_doc.convert_to_replaced();
             stack.emplace_back(member_upper, std::move(member_doc));
+            prefetch_members(stack);
             append_included_member(std::make_unique<included_member_details>(
                 included_member_details { std::move(member_upper), std::move(lib_text), std::move(lib_loc) }));
         }
@@ -118,6 +153,7 @@ public:
     [[nodiscard]] utils::value_task<document> generate_replacement(document doc) override
     {
         reset();
+        m_prefetcher.clear();
 
         if (std::none_of(doc.begin(), doc.end(), [](const auto& l) {
                 auto text = l.text();
@@ -125,13 +161,14 @@ public:
             }))
             co_return doc;
 
-        static std::regex include_regex(R"(^(-INC|\+\+INCLUDE)\s+(\S+)(?:\s+(.*))?)");
+        const auto& include_regex = get_include_regex();
 
         std::vector<document_line> result;
         result.reserve(doc.size());
 
         std::vector<stack_entry> stack;
         stack.emplace_back(std::string(), std::move(doc));
+        prefetch_members(stack);
 
         std::match_results<std::string_view::iterator> matches;
 
@@ -148,7 +185,7 @@ public:
 
             if (const auto& text = line.text(); !std::regex_search(text.begin(), text.end(), matches, include_regex))
             {
-                result.push_back(line);
+                result.emplace_back(line);
                 continue;
             }
 
@@ -21,6 +21,7 @@
 
 #include "lexing/logical_line.h"
 #include "utils/string_operations.h"
+#include "workspaces/file.h"
 
 namespace hlasm_plugin::parser_library::processing {
 namespace {
@@ -198,4 +199,35 @@ get_preproc_statement<semantics::endevor_statement_si, std::string_view::iterato
     size_t lineno,
     bool contains_preproc_specific_instruction,
     size_t continuation_column);
+
+void member_prefetcher::request(const library_fetcher& libs, std::vector<std::string> members_upper)
+{
+    if (!libs)
+        return;
+
+    for (auto& member_upper : members_upper)
+    {
+        if (m_requested.contains(member_upper))
+            continue;
+        auto pending = libs(member_upper);
+        m_requested.try_emplace(std::move(member_upper), std::move(pending));
+    }
+}
+
+utils::value_task<member_prefetcher::fetch_result> member_prefetcher::get(
+    const library_fetcher& libs, std::string member_upper)
+{
+    if (auto it = m_requested.find(member_upper); it != m_requested.end())
+    {
+        auto result = std::move(it->second);
+        m_requested.erase(it);
+        return result;
+    }
+
+    if (!libs)
+        return utils::value_task<fetch_result>::from_value(std::nullopt);
+
+    return libs(std::move(member_upper));
+}
+
 } // namespace hlasm_plugin::parser_library::processing
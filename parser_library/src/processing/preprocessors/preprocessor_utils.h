@@ -19,12 +19,16 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "processing/preprocessor.h"
 #include "semantics/range_provider.h"
 #include "semantics/statement.h"
+#include "utils/task.h"
 
 namespace hlasm_plugin::parser_library::processing {
 
@@ -59,6 +63,26 @@ std::shared_ptr<PREPROC_STATEMENT> get_preproc_statement(std::span<const std::pa
     bool contains_preproc_specific_instruction,
     size_t continue_column = 15);
 
+// Requests included members discovered in the source before the preprocessor reaches them, so that the requests
+// overlap. The returned tasks are kept unstarted and awaited only when the member is included, a library task must
+// never be resumed outside of the chain driving it.
+class member_prefetcher
+{
+public:
+    using fetch_result = std::optional<
+        std::pair<std::shared_ptr<const workspaces::text_buffer>, utils::resource::resource_location>>;
+
+    void request(const library_fetcher& libs, std::vector<std::string> members_upper);
+    // returns the requested member or fetches it now
+    [[nodiscard]] utils::value_task<fetch_result> get(const library_fetcher& libs, std::string member_upper);
+
+    void clear() { m_requested.clear(); }
+    size_t requested() const { return m_requested.size(); }
+
+private:
+    std::unordered_map<std::string, utils::value_task<fetch_result>> m_requested;
+};
+
 } // namespace hlasm_plugin::parser_library::processing
 
 #endif
@@ -40,7 +40,8 @@ processing_manager::processing_manager(std::unique_ptr<opencode_provider> base_p
     std::string_view file_text,
     workspaces::parse_lib_provider& lib_provider,
     statement_fields_parser& parser,
-    std::shared_ptr<std::vector<fade_message_s>> fade_msgs)
+    std::shared_ptr<std::vector<fade_message_s>> fade_msgs,
+    bool syntax_only)
     : diagnosable_ctx(*ctx.hlasm_ctx)
     , ctx_(std::move(ctx))
     , hlasm_ctx_(*ctx_.hlasm_ctx)
@@ -55,8 +56,8 @@ processing_manager::processing_manager(std::unique_ptr<opencode_provider> base_p
     {
         case processing_kind::ORDINARY:
             provs_.emplace_back(std::make_unique<macro_statement_provider>(ctx_, parser, lib_provider, *this, *this));
-            procs_.emplace_back(
-                std::make_unique<ordinary_processor>(ctx_, *this, lib_provider, *this, parser, opencode_prov_, *this));
+            procs_.emplace_back(std::make_unique<ordinary_processor>(
+                ctx_, *this, lib_provider, *this, parser, opencode_prov_, *this, syntax_only));
             break;
         case processing_kind::COPY:
             start_copy_member(copy_start_data { data.library_member, std::move(file_loc) });
@@ -116,7 +117,7 @@ utils::task processing_manager::co_step()
 
         if ((prov.finished() && proc.terminal_condition(prov.kind)) || proc.finished())
         {
-            finish_processor();
+            co_await finish_processor();
             continue;
         }
 
@@ -192,9 +193,11 @@ statement_provider& processing_manager::find_provider() const
     return *provs_.back();
 }
 
-void processing_manager::finish_processor()
+utils::task processing_manager::finish_processor()
 {
     procs_.back()->end_processing();
+    if (finish_task_.valid())
+        co_await std::exchange(finish_task_, {});
     collect_diags_from_child(*procs_.back());
     procs_.pop_back();
 }
@@ -351,6 +354,12 @@ void processing_manager::schedule_helper_task(utils::task t)
         helper_task_ = std::move(helper_task_).then(std::move(t));
 }
 
+void processing_manager::schedule_finish_task(utils::task t)
+{
+    assert(!finish_task_.valid());
+    finish_task_ = std::move(t);
+}
+
 void processing_manager::start_macro_definition(
     macrodef_start_data start, std::optional<utils::resource::resource_location> file_loc)
 {
@@ -53,7 +53,8 @@ public:
         std::string_view file_text,
         workspaces::parse_lib_provider& lib_provider,
         statement_fields_parser& parser,
-        std::shared_ptr<std::vector<fade_message_s>> fade_msgs);
+        std::shared_ptr<std::vector<fade_message_s>> fade_msgs,
+        bool syntax_only = false);
 
     [[nodiscard]] utils::task co_step();
 
@@ -72,6 +73,9 @@ public:
     void process_postponed_statements(const std::vector<
         std::pair<std::unique_ptr<context::postponed_statement>, context::dependency_evaluation_context>>& stmts);
 
+    // task that must complete before the currently finishing processor is removed
+    void schedule_finish_task(utils::task t);
+
     parsing::hlasmparser_multiline& opencode_parser(); // for testing only
 
 private:
@@ -84,6 +88,7 @@ private:
     std::vector<provider_ptr> provs_;
 
     utils::task helper_task_;
+    utils::task finish_task_;
 
     lsp_analyzer lsp_analyzer_;
     std::vector<statement_analyzer*> stms_analyzers_;
@@ -111,7 +116,7 @@ private:
     bool lookahead_active() const;
 
     statement_provider& find_provider() const;
-    void finish_processor();
+    [[nodiscard]] utils::task finish_processor();
     void finish_preprocessor();
 
     void start_macro_definition(macrodef_start_data start) override;
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <utility>
 
 #include "context/hlasm_context.h"
@@ -174,7 +175,7 @@ lsp::line_occurence_details& lsp_analyzer::line_details(const range& r, const co
 void lsp_analyzer::collect_endline(const range& r, const collection_info_t& ci)
 {
     auto& line_detail = line_details(r, ci);
-    line_detail.max_endline = std::max(line_detail.max_endline, r.end.line + 1);
+    line_detail.max_endline = std::max(line_detail.max_endline, static_cast<std::uint32_t>(r.end.line + 1));
 }
 
 void lsp_analyzer::collect_usings(const range& r, const collection_info_t& ci)
@@ -14,6 +14,8 @@
 
 #include "ordinary_processor.h"
 
+#include <algorithm>
+#include <array>
 #include <stdexcept>
 
 #include "checking/diagnostic_collector.h"
@@ -30,6 +32,7 @@
 #include "processing/instruction_sets/postponed_statement_impl.h"
 #include "processing/processing_manager.h"
 #include "semantics/operand_impls.h"
+#include "utils/task.h"
 #include "utils/truth_table.h"
 
 namespace hlasm_plugin::parser_library::processing {
@@ -40,7 +43,8 @@ ordinary_processor::ordinary_processor(analyzing_context ctx,
     processing_state_listener& state_listener,
     statement_fields_parser& parser,
     opencode_provider& open_code,
-    processing_manager& proc_mgr)
+    processing_manager& proc_mgr,
+    bool syntax_only)
     : statement_processor(processing_kind::ORDINARY, ctx)
     , branch_provider_(branch_provider)
     , lib_info(lib_provider)
@@ -50,6 +54,7 @@ ordinary_processor::ordinary_processor(analyzing_context ctx,
     , asm_proc_(ctx, branch_provider, lib_provider, parser, open_code, proc_mgr)
     , mach_proc_(ctx, branch_provider, lib_provider, parser, proc_mgr)
     , finished_flag_(false)
+    , syntax_only_(syntax_only)
     , listener_(state_listener)
     , proc_mgr(proc_mgr)
 {}
@@ -114,6 +119,16 @@ void ordinary_processor::process_statement(context::shared_stmt_ptr s)
         return;
     }
 
+    if (syntax_only_)
+    {
+        // only the instructions that change how the rest of the file is parsed or where it ends
+        if (static const std::array parsing_relevant { context::id_index("OPSYN"), context::id_index("END") };
+            statement->opcode_ref().type == context::instruction_type::ASM
+            && std::ranges::find(parsing_relevant, statement->opcode_ref().value) != parsing_relevant.end())
+            asm_proc_.process(std::move(statement));
+        return;
+    }
+
     switch (statement->opcode_ref().type)
     {
         case context::instruction_type::UNDEF:
@@ -138,14 +153,13 @@ void ordinary_processor::process_statement(context::shared_stmt_ptr s)
     }
 }
 
-void ordinary_processor::process_postponed_statements(
-    const std::vector<std::pair<context::post_stmt_ptr, context::dependency_evaluation_context>>& stmts)
+void ordinary_processor::end_processing()
 {
-    proc_mgr.process_postponed_statements(stmts);
-    check_postponed_statements(stmts);
+    // the processing at END may take a while in large programs, give the caller a chance to interrupt
+    proc_mgr.schedule_finish_task(finish_end_processing());
 }
 
-void ordinary_processor::end_processing()
+utils::task ordinary_processor::finish_end_processing()
 {
     if (hlasm_ctx.ord_ctx.literals().get_pending_count())
     {
@@ -153,7 +167,7 @@ void ordinary_processor::end_processing()
         hlasm_ctx.ord_ctx.set_location_counter(ltorg->name, {}, lib_info);
         hlasm_ctx.ord_ctx.set_available_location_counter_value(lib_info);
 
-        hlasm_ctx.ord_ctx.generate_pool(*this, hlasm_ctx.using_current(), lib_info);
+        co_await hlasm_ctx.ord_ctx.generate_pool(*this, hlasm_ctx.using_current(), lib_info);
     }
 
     hlasm_ctx.ord_ctx.start_reporting_label_candidates();
@@ -165,14 +179,16 @@ void ordinary_processor::end_processing()
 
     hlasm_ctx.ord_ctx.finish_module_layout(&asm_proc_, lib_info);
 
-    hlasm_ctx.ord_ctx.symbol_dependencies().resolve_all_as_default();
+    co_await hlasm_ctx.ord_ctx.symbol_dependencies().resolve_all_as_default();
 
     // do not replace stack trace in the messages - it is already provided
     diagnostic_consumer_transform using_diags(
         [this](diagnostic_s d) { diagnosable_impl::add_diagnostic(std::move(d)); });
     hlasm_ctx.using_resolve(using_diags, lib_info);
 
-    process_postponed_statements(hlasm_ctx.ord_ctx.symbol_dependencies().collect_postponed());
+    const auto stmts = hlasm_ctx.ord_ctx.symbol_dependencies().collect_postponed();
+    proc_mgr.process_postponed_statements(stmts);
+    co_await check_postponed_statements(stmts);
 
     hlasm_ctx.pop_statement_processing();
 
@@ -507,7 +523,7 @@ bool statement_check(const resolved_statement& stmt,
 
 } // namespace
 
-void ordinary_processor::check_postponed_statements(
+utils::task ordinary_processor::check_postponed_statements(
     const std::vector<std::pair<context::post_stmt_ptr, context::dependency_evaluation_context>>& stmts)
 {
     static const checking::assembler_checker asm_checker;
@@ -535,6 +551,8 @@ void ordinary_processor::check_postponed_statements(
                 assert(false);
                 break;
         }
+
+        co_await utils::task::yield();
     }
 }
 
@@ -46,6 +46,7 @@ class ordinary_processor final : public statement_processor
     mach_processor mach_proc_;
 
     bool finished_flag_;
+    bool syntax_only_;
 
     processing_state_listener& listener_;
     processing_manager& proc_mgr;
@@ -57,7 +58,8 @@ public:
         processing_state_listener& state_listener,
         statement_fields_parser& parser,
         opencode_provider& open_code,
-        processing_manager& proc_mgr);
+        processing_manager& proc_mgr,
+        bool syntax_only = false);
 
     std::optional<processing_status> get_processing_status(
         const std::optional<context::id_index>& instruction, const range& r) const override;
@@ -73,9 +75,8 @@ public:
     void collect_diags() const override;
 
 private:
-    void process_postponed_statements(const std::vector<
-        std::pair<std::unique_ptr<context::postponed_statement>, context::dependency_evaluation_context>>& stmts);
-    void check_postponed_statements(const std::vector<
+    [[nodiscard]] utils::task finish_end_processing();
+    [[nodiscard]] utils::task check_postponed_statements(const std::vector<
         std::pair<std::unique_ptr<context::postponed_statement>, context::dependency_evaluation_context>>& stmts);
     bool check_fatals(range line_range);
 
@@ -189,6 +189,7 @@ scope::scope(const debugging::scope& impl)
     : name(impl.name)
     , variable_reference(impl.var_reference)
     , source_file(impl.scope_source)
+    , named_variables(impl.named_variables)
 {}
 
 scope sequence_item_get(const sequence<scope, const debugging::scope*>* self, size_t index)
@@ -206,9 +207,9 @@ variable::variable(const debugging::variable& impl)
     , type(impl.type())
 {}
 
-variable sequence_item_get(const sequence<variable, const debugging::variable_store*>* self, size_t index)
+variable sequence_item_get(const sequence<variable, const std::unique_ptr<debugging::variable>*>* self, size_t index)
 {
-    return variable(*self->stor_->variables[index]);
+    return variable(*self->stor_[index]);
 }
 
 
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "highlighting_info.h"
+
+#include <limits>
+
+namespace hlasm_plugin::parser_library::semantics {
+
+packed_lines_info::packed_lines_info(const lines_info& tokens)
+{
+    m_entries.reserve(tokens.size());
+    for (const auto& t : tokens)
+        push_back(t);
+    m_unpacked.shrink_to_fit();
+}
+
+void packed_lines_info::push_back(const token_info& t)
+{
+    constexpr auto max_column = std::numeric_limits<std::uint16_t>::max();
+    constexpr auto max_delta = (size_t)std::numeric_limits<std::int32_t>::max();
+
+    const auto& [start, end] = t.token_range;
+    const bool fits = start.line <= m_last_line + max_delta && m_last_line <= start.line + max_delta
+        && start.column <= max_column && end.column <= max_column && start.line <= end.line
+        && end.line - start.line < unpacked_span && (size_t)t.scope <= std::numeric_limits<std::uint8_t>::max();
+
+    if (!fits)
+    {
+        m_entries.push_back({ 0, 0, 0, unpacked_span, 0 });
+        m_unpacked.push_back(t);
+    }
+    else
+    {
+        m_entries.push_back({
+            static_cast<std::int32_t>(start.line - m_last_line),
+            static_cast<std::uint16_t>(start.column),
+            static_cast<std::uint16_t>(end.column),
+            static_cast<std::uint8_t>(end.line - start.line),
+            static_cast<std::uint8_t>(t.scope),
+        });
+    }
+    m_last_line = start.line;
+}
+
+lines_info packed_lines_info::unpack() const
+{
+    lines_info result;
+    result.reserve(m_entries.size());
+
+    size_t line = 0;
+    auto unpacked = m_unpacked.begin();
+    for (const auto& e : m_entries)
+    {
+        if (e.line_span == unpacked_span)
+        {
+            const auto& t = result.emplace_back(*unpacked++);
+            line = t.token_range.start.line;
+            continue;
+        }
+        line += e.line_delta;
+        result.emplace_back(line, e.start_column, line + e.line_span, e.end_column, static_cast<hl_scopes>(e.scope));
+    }
+
+    return result;
+}
+
+} // namespace hlasm_plugin::parser_library::semantics
@@ -15,6 +15,8 @@
 #ifndef HIGHLIGHTING_INFO
 #define HIGHLIGHTING_INFO
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
@@ -27,6 +29,41 @@ namespace hlasm_plugin::parser_library::semantics {
 // vector of tokens
 using lines_info = std::vector<token_info>;
 
+// Semantic tokens of a single file kept for as long as the file is opened, each token is packed into 12 bytes.
+// Start lines are encoded relative to the previous token, tokens that do not fit the packed form are stored aside.
+class packed_lines_info
+{
+    struct entry
+    {
+        std::int32_t line_delta;
+        std::uint16_t start_column;
+        std::uint16_t end_column;
+        std::uint8_t line_span;
+        std::uint8_t scope;
+    };
+    static constexpr std::uint8_t unpacked_span = 0xff;
+
+    std::vector<entry> m_entries;
+    std::vector<token_info> m_unpacked;
+    size_t m_last_line = 0;
+
+public:
+    packed_lines_info() = default;
+    explicit packed_lines_info(const lines_info& tokens);
+
+    void push_back(const token_info& t);
+    lines_info unpack() const;
+
+    size_t size() const noexcept { return m_entries.size(); }
+    bool empty() const noexcept { return m_entries.empty(); }
+
+    // number of bytes allocated for the tokens
+    size_t memory_usage() const noexcept
+    {
+        return m_entries.capacity() * sizeof(entry) + m_unpacked.capacity() * sizeof(token_info);
+    }
+};
+
 // representation about the changes in continuation
 struct continuation_info
 {
@@ -312,18 +312,30 @@ public:
 
     bool run_active_task(const std::atomic<unsigned char>* yield_indicator)
     {
-        const auto& [task, ows, start] = m_active_task;
+        auto& [task, ows, start, longest_slice] = m_active_task;
+        const auto slice_start = std::chrono::steady_clock::now();
         task.resume(yield_indicator);
+        const auto slice_end = std::chrono::steady_clock::now();
+        longest_slice = std::max(longest_slice, slice_end - slice_start);
         if (!task.done())
             return false;
 
-        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        std::chrono::duration<double> duration = slice_end - start;
 
-        const auto& [url, metadata, perf_metrics, errors, warnings] = task.value();
+        const auto& [url, metadata, perf_metrics, errors, warnings, preliminary] = task.value();
+
+        if (preliminary)
+            notify_diagnostics_consumers();
 
         if (perf_metrics)
         {
-            parsing_metadata data { perf_metrics.value(), metadata, errors, warnings };
+            parsing_metadata data {
+                perf_metrics.value(),
+                metadata,
+                errors,
+                warnings,
+                std::chrono::duration<double>(longest_slice).count(),
+            };
             for (auto consumer : m_parsing_metadata_consumers)
                 consumer->consume_parsing_metadata(sequence<char>(url.get_uri()), duration.count(), data);
         }
@@ -760,9 +772,30 @@ public:
         });
     }
 
+    void macro_trace(const char* document_uri,
+        macro_trace_format format,
+        workspace_manager_response<continuous_sequence<char>> r) override
+    {
+        handle_request(document_uri, std::move(r), [format](const auto& resp, auto& ws, const auto& doc_loc) {
+            resp.provide(make_continuous_sequence(ws.macro_trace(doc_loc, format)));
+        });
+    }
+
     continuous_sequence<char> get_virtual_file_content(unsigned long long id) const override
     {
-        return make_continuous_sequence(m_file_manager.get_virtual_file(id));
+        // the response keeps the stored text alive instead of copying it
+        struct shared_text
+        {
+            std::shared_ptr<const std::string> text;
+
+            const char* data() const noexcept { return text->data(); }
+            size_t size() const noexcept { return text->size(); }
+        };
+
+        auto text = m_file_manager.get_virtual_file(id);
+        if (!text)
+            return {};
+        return make_continuous_sequence(shared_text { std::move(text) });
     }
 
     void toggle_advisory_configuration_diagnostics() override
@@ -970,6 +1003,7 @@ private:
         utils::value_task<workspaces::parse_file_result> task;
         opened_workspace* ows = nullptr;
         std::chrono::steady_clock::time_point start_time;
+        std::chrono::steady_clock::duration longest_slice = {};
 
         bool valid() const noexcept { return task.valid(); }
     } m_active_task;
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "dependency_diagnostics.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "utils/general_hashers.h"
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+namespace {
+size_t diagnostic_hash(const diagnostic_s& d)
+{
+    using utils::hashers::hash_combine;
+
+    size_t result = std::hash<std::string>()(d.file_uri);
+    result = hash_combine(result, std::hash<std::string>()(d.code));
+    result = hash_combine(result, std::hash<std::string>()(d.message));
+    result = hash_combine(result, d.diag_range.start.line);
+    result = hash_combine(result, d.diag_range.start.column);
+    result = hash_combine(result, d.diag_range.end.line);
+    result = hash_combine(result, d.diag_range.end.column);
+    result = hash_combine(result, (size_t)d.severity);
+    result = hash_combine(result, (size_t)d.tag);
+    return result;
+}
+
+// the related information (processing stack) is kept by the programs
+bool same_diagnostic(const diagnostic_s& l, const diagnostic_s& r)
+{
+    return l.diag_range == r.diag_range && l.severity == r.severity && l.tag == r.tag && l.code == r.code
+        && l.message == r.message && l.file_uri == r.file_uri;
+}
+
+size_t compute_context_key(const std::vector<diagnostic_s>& diags)
+{
+    size_t result = diags.size();
+    for (const auto& d : diags)
+        result = utils::hashers::hash_combine(result, diagnostic_hash(d));
+    return result;
+}
+} // namespace
+
+size_t dependency_diagnostics_store::key_hasher::operator()(const key& k) const
+{
+    using utils::hashers::hash_combine;
+    return hash_combine(
+        hash_combine(utils::resource::resource_location_hasher()(k.location), k.version), k.context_key);
+}
+
+void dependency_diagnostics_store::prune() { std::erase_if(m_sets, [](const auto& e) { return e.second.expired(); }); }
+
+std::shared_ptr<const dependency_diagnostics> dependency_diagnostics_store::intern_set(
+    utils::resource::resource_location location, version_t version, std::vector<diagnostic_s> diags)
+{
+    const auto context_key = compute_context_key(diags);
+
+    auto [it, inserted] = m_sets.try_emplace(key { location, version, context_key });
+    if (auto existing = it->second.lock(); existing)
+    {
+        if (std::ranges::equal(existing->diags, diags, same_diagnostic))
+            return existing;
+
+        // hash collision, the set is not shared
+        return std::make_shared<const dependency_diagnostics>(
+            dependency_diagnostics { std::move(location), version, context_key, std::move(diags) });
+    }
+
+    auto result = std::make_shared<const dependency_diagnostics>(
+        dependency_diagnostics { std::move(location), version, context_key, std::move(diags) });
+    it->second = result;
+
+    if (inserted && m_sets.size() > 2 * m_live_after_prune + 64)
+    {
+        prune();
+        m_live_after_prune = m_sets.size();
+    }
+
+    return result;
+}
+
+dependency_diagnostics_use dependency_diagnostics_store::intern(
+    utils::resource::resource_location location, version_t version, std::vector<diagnostic_s> diags)
+{
+    size_t related_count = 0;
+    for (const auto& d : diags)
+        related_count += d.related.size();
+
+    std::vector<diagnostic_related_info_s> related;
+    std::vector<size_t> related_end;
+    related.reserve(related_count);
+    related_end.reserve(diags.size());
+    for (auto& d : diags)
+    {
+        std::ranges::move(d.related, std::back_inserter(related));
+        d.related.clear();
+        related_end.push_back(related.size());
+    }
+
+    return { intern_set(std::move(location), version, std::move(diags)), std::move(related), std::move(related_end) };
+}
+
+size_t dependency_diagnostics_store::size() const
+{
+    return std::ranges::count_if(m_sets, [](const auto& e) { return !e.second.expired(); });
+}
+
+void merge_dependency_diagnostics(
+    std::vector<diagnostic_s>& target, std::span<const dependency_diagnostics_use* const> uses)
+{
+    struct diag_hasher
+    {
+        size_t operator()(const diagnostic_s* d) const { return diagnostic_hash(*d); }
+    };
+    struct diag_equal
+    {
+        bool operator()(const diagnostic_s* l, const diagnostic_s* r) const { return same_diagnostic(*l, *r); }
+    };
+
+    // position of the reported diagnostic in the target
+    std::unordered_map<const diagnostic_s*, size_t, diag_hasher, diag_equal> reported;
+
+    for (const auto* u : uses)
+    {
+        for (size_t i = 0; i < u->set->diags.size(); ++i)
+        {
+            const auto& d = u->set->diags[i];
+            auto [it, inserted] = reported.try_emplace(&d, target.size());
+            if (inserted)
+                target.push_back(d);
+            if (i < u->related_end.size())
+            {
+                auto& related = target[it->second].related;
+                const auto begin = u->related.begin() + (i ? u->related_end[i - 1] : 0);
+                related.insert(related.end(), begin, u->related.begin() + u->related_end[i]);
+            }
+        }
+    }
+}
+
+} // namespace hlasm_plugin::parser_library::workspaces
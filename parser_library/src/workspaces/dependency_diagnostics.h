@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_DEPENDENCY_DIAGNOSTICS_H
+#define HLASMPLUGIN_PARSERLIBRARY_DEPENDENCY_DIAGNOSTICS_H
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "diagnostic.h"
+#include "protocol.h"
+#include "utils/resource_location.h"
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+// Diagnostics located in a single dependency (macro or copy member) produced while analyzing a program, the related
+// information (processing stack) differs between programs and is not part of the diagnostics
+struct dependency_diagnostics
+{
+    utils::resource::resource_location location;
+    version_t version;
+    // identifies the content of the set, the processing stack details are not part of it
+    size_t context_key;
+    std::vector<diagnostic_s> diags;
+};
+
+// Shared diagnostic set referenced by a program together with the related information the program produced
+struct dependency_diagnostics_use
+{
+    std::shared_ptr<const dependency_diagnostics> set;
+    // related information of all diagnostics in the set, concatenated in the same order. The processing stack ends in
+    // the program itself, so this part stays per program.
+    std::vector<diagnostic_related_info_s> related;
+    // end of the related information of each diagnostic in the set
+    std::vector<size_t> related_end;
+};
+
+// Keeps a single instance of identical diagnostic sets, so that programs including the same dependency share them
+class dependency_diagnostics_store
+{
+    struct key
+    {
+        utils::resource::resource_location location;
+        version_t version;
+        size_t context_key;
+
+        bool operator==(const key&) const = default;
+    };
+    struct key_hasher
+    {
+        size_t operator()(const key& k) const;
+    };
+
+    std::unordered_map<key, std::weak_ptr<const dependency_diagnostics>, key_hasher> m_sets;
+    size_t m_live_after_prune = 0;
+
+    void prune();
+
+    std::shared_ptr<const dependency_diagnostics> intern_set(
+        utils::resource::resource_location location, version_t version, std::vector<diagnostic_s> diags);
+
+public:
+    dependency_diagnostics_use intern(
+        utils::resource::resource_location location, version_t version, std::vector<diagnostic_s> diags);
+
+    // number of distinct sets still referenced by some program
+    size_t size() const;
+};
+
+// Appends the diagnostics of all sets, every distinct diagnostic of a dependency is reported only once together with
+// the related information of all programs that produced it
+void merge_dependency_diagnostics(
+    std::vector<diagnostic_s>& target, std::span<const dependency_diagnostics_use* const> uses);
+
+} // namespace hlasm_plugin::parser_library::workspaces
+
+#endif
@@ -71,6 +71,14 @@ void create_line_indices(std::vector<size_t>& output, std::string_view text)
     find_newlines(output, text);
 }
 
+std::shared_ptr<const text_buffer> make_text_buffer(std::string text)
+{
+    auto result = std::make_shared<text_buffer>();
+    result->text = std::move(text);
+    create_line_indices(result->line_indices, result->text);
+    return result;
+}
+
 void apply_text_diff(std::string& text, std::vector<size_t>& lines, range r, std::string_view replacement)
 {
     if (r.start > r.end || r.end.line > lines.size())
@@ -15,6 +15,7 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_FILE_H
 #define HLASMPLUGIN_PARSERLIBRARY_FILE_H
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -24,6 +25,13 @@
 
 namespace hlasm_plugin::parser_library::workspaces {
 
+// Text with offsets of the beginnings of its lines, immutable once shared
+struct text_buffer
+{
+    std::string text;
+    std::vector<size_t> line_indices;
+};
+
 // Interface that represents both file opened in LSP
 // as well as a file opened by parser library from the disk.
 class file
@@ -32,6 +40,8 @@ public:
     virtual const utils::resource::resource_location& get_location() const = 0;
     // Gets contents of file either by loading from disk or from LSP.
     virtual const std::string& get_text() const = 0;
+    // Shares the contents and their line indices without copying, the buffer keeps the file alive.
+    virtual std::shared_ptr<const text_buffer> get_text_buffer() const = 0;
     // Returns whether file is open by LSP.
     virtual bool get_lsp_editing() const = 0;
     // Internal unique version
@@ -52,6 +62,8 @@ void find_newlines(std::vector<size_t>& output, std::string_view text);
 // Generates vector of offsets to the beginning of individual lines
 std::vector<size_t> create_line_indices(std::string_view text);
 void create_line_indices(std::vector<size_t>& output, std::string_view text);
+// Wraps text that is not owned by the file manager
+std::shared_ptr<const text_buffer> make_text_buffer(std::string text);
 // Returns the location in text that corresponds to utf-16 based location
 // The position may point beyond the last character -> returns text.size()
 size_t index_from_position(std::string_view text, const std::vector<size_t>& line_indices, position pos);
@@ -76,7 +76,8 @@ public:
     virtual std::string_view put_virtual_file(
         unsigned long long id, std::string_view text, utils::resource::resource_location related_workspace) = 0;
     virtual void remove_virtual_file(unsigned long long id) = 0;
-    virtual std::string get_virtual_file(unsigned long long id) const = 0;
+    // the text is shared, so it stays available even when the file is removed in the meantime
+    virtual std::shared_ptr<const std::string> get_virtual_file(unsigned long long id) const = 0;
     virtual utils::resource::resource_location get_virtual_file_workspace(unsigned long long id) const = 0;
 
     [[nodiscard]] virtual utils::value_task<file_content_state> update_file(
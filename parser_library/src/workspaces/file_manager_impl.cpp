@@ -42,12 +42,11 @@ struct file_manager_impl::mapped_file final : file
     std::shared_ptr<mapped_file> shared_from_this() const noexcept { return m_self.lock(); }
 
     utils::resource::resource_location m_location;
-    std::string m_text;
+    // modified only while the file is not shared
+    text_buffer m_content;
     struct file_error
     {};
     std::optional<file_error> m_error;
-    // Array of "pointers" to m_text where lines start.
-    std::vector<size_t> m_lines;
 
     file_manager_impl& m_fm;
 
@@ -60,10 +59,11 @@ struct file_manager_impl::mapped_file final : file
 
     mapped_file(const utils::resource::resource_location& file_name, file_manager_impl& fm, std::string text)
         : m_location(file_name)
-        , m_text(std::move(text))
-        , m_lines(create_line_indices(m_text))
+        , m_content { std::move(text), {} }
         , m_fm(fm)
-    {}
+    {
+        create_line_indices(m_content.line_indices, m_content.text);
+    }
 
     mapped_file(const utils::resource::resource_location& file_name, file_manager_impl& fm, file_error error)
         : m_location(file_name)
@@ -73,9 +73,8 @@ struct file_manager_impl::mapped_file final : file
 
     mapped_file(const mapped_file& that)
         : m_location(that.m_location)
-        , m_text(that.m_text)
+        , m_content(that.m_content)
         , m_error(that.m_error)
-        , m_lines(that.m_lines)
         , m_fm(that.m_fm)
         , m_lsp_version(that.m_lsp_version)
     {}
@@ -89,7 +88,11 @@ struct file_manager_impl::mapped_file final : file
 
     // Inherited via file
     const utils::resource::resource_location& get_location() const override { return m_location; }
-    const std::string& get_text() const override { return m_text; }
+    const std::string& get_text() const override { return m_content.text; }
+    std::shared_ptr<const text_buffer> get_text_buffer() const override
+    {
+        return std::shared_ptr<const text_buffer>(shared_from_this(), &m_content);
+    }
     bool get_lsp_editing() const override { return m_editing_self_reference != nullptr; }
     version_t get_version() const override { return m_version; }
     version_t get_lsp_version() const override { return m_lsp_version; }
@@ -106,7 +109,7 @@ struct file_manager_impl::mapped_file final : file
         if (m_error.has_value())
             return std::nullopt;
         else
-            return m_text;
+            return m_content.text;
     }
 };
 
@@ -231,7 +234,7 @@ std::shared_ptr<file_manager_impl::mapped_file> file_manager_impl::try_obtaining
         if (!expected_text)
             return {};
 
-        if (file->m_text != *expected_text)
+        if (file->m_content.text != *expected_text)
         {
             file->m_it = m_files.end();
             m_files.erase(it);
@@ -296,7 +299,7 @@ file_content_state file_manager_impl::did_open_file(
     if (it != m_files.end())
         locked = it->second.file->shared_from_this();
 
-    if (!locked || locked->m_error || locked->m_text != new_text)
+    if (!locked || locked->m_error || locked->m_content.text != new_text)
     {
         if (it != m_files.end())
         {
@@ -370,14 +373,15 @@ void file_manager_impl::did_change_file(const utils::resource::resource_location
 
     if (last_whole->whole)
     {
-        file->m_text = std::string_view(last_whole->text, last_whole->text_length);
+        file->m_content.text = std::string_view(last_whole->text, last_whole->text_length);
+        create_line_indices(file->m_content.line_indices, file->m_content.text);
         ++last_whole;
     }
 
     for (const auto& change : std::span(last_whole, changes_start + ch_size))
     {
         std::string_view text_s(change.text, change.text_length);
-        apply_text_diff(file->m_text, file->m_lines, change.change_range, text_s);
+        apply_text_diff(file->m_content.text, file->m_content.line_indices, change.change_range, text_s);
     }
 
     file->m_lsp_version = lsp_version;
@@ -411,7 +415,7 @@ std::string_view file_manager_impl::put_virtual_file(
     unsigned long long id, std::string_view text, utils::resource::resource_location related_workspace)
 {
     std::lock_guard guard(virtual_files_mutex);
-    return m_virtual_files.try_emplace(id, text, std::move(related_workspace)).first->second.text;
+    return *m_virtual_files.try_emplace(id, text, std::move(related_workspace)).first->second.text;
 }
 
 void file_manager_impl::remove_virtual_file(unsigned long long id)
@@ -420,12 +424,12 @@ void file_manager_impl::remove_virtual_file(unsigned long long id)
     m_virtual_files.erase(id);
 }
 
-std::string file_manager_impl::get_virtual_file(unsigned long long id) const
+std::shared_ptr<const std::string> file_manager_impl::get_virtual_file(unsigned long long id) const
 {
     std::lock_guard guard(virtual_files_mutex);
     if (auto it = m_virtual_files.find(id); it != m_virtual_files.end())
         return it->second.text;
-    return {};
+    return nullptr;
 }
 
 utils::resource::resource_location file_manager_impl::get_virtual_file_workspace(unsigned long long id) const
@@ -81,7 +81,7 @@ public:
     std::string_view put_virtual_file(
         unsigned long long id, std::string_view text, utils::resource::resource_location related_workspace) override;
     void remove_virtual_file(unsigned long long id) override;
-    std::string get_virtual_file(unsigned long long id) const override;
+    std::shared_ptr<const std::string> get_virtual_file(unsigned long long id) const override;
     utils::resource::resource_location get_virtual_file_workspace(unsigned long long id) const override;
 
     [[nodiscard]] utils::value_task<file_content_state> update_file(
@@ -94,15 +94,11 @@ private:
     const external_file_reader* m_file_reader;
     struct virtual_file_entry
     {
-        std::string text;
+        std::shared_ptr<const std::string> text;
         utils::resource::resource_location related_workspace;
 
         virtual_file_entry(std::string_view text, utils::resource::resource_location related_workspace)
-            : text(text)
-            , related_workspace(std::move(related_workspace))
-        {}
-        virtual_file_entry(std::string text, utils::resource::resource_location related_workspace)
-            : text(std::move(text))
+            : text(std::make_shared<const std::string>(text))
             , related_workspace(std::move(related_workspace))
         {}
     };
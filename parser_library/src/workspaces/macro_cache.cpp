@@ -14,7 +14,9 @@
 
 #include "macro_cache.h"
 
+#include <algorithm>
 #include <array>
+#include <string_view>
 
 #include "analyzer.h"
 #include "context/hlasm_context.h"
@@ -22,9 +24,29 @@
 #include "file.h"
 #include "file_manager.h"
 #include "lsp/lsp_context.h"
+#include "lsp/text_data_view.h"
 
 namespace hlasm_plugin::parser_library::workspaces {
 
+namespace {
+// text of lines [first, last) of the file
+std::string_view line_block(const lsp::text_data_view& text, size_t first, size_t last)
+{
+    const auto block = text.get_lines_beginning_at(position(first, 0));
+    if (last <= first)
+        return block.substr(0, 0);
+    return block.substr(0, block.size() - text.get_lines_beginning_at(position(last, 0)).size());
+}
+
+// first line following the statement in the macro file
+size_t next_statement_line(const context::macro_definition& def, size_t i, const lsp::text_data_view& text)
+{
+    if (i + 1 < def.copy_nests.size())
+        return def.copy_nests[i + 1].front().loc.pos.line;
+    return text.get_number_of_lines();
+}
+} // namespace
+
 macro_cache::macro_cache(const file_manager& file_mngr, std::shared_ptr<file> macro_file)
     : file_mngr_(&file_mngr)
     , macro_file_(std::move(macro_file))
@@ -97,21 +119,21 @@ std::optional<std::vector<std::shared_ptr<file>>> macro_cache::load_from_cache(
             if (!info)
                 return result; // The file for which the analyzer is cached does not contain definition of macro
             ctx.hlasm_ctx->add_macro(info->macro_definition, info->external);
-            ctx.lsp_ctx->add_macro(info, lsp::text_data_view(macro_file_->get_text()));
+            ctx.lsp_ctx->add_macro(info, lsp::text_data_view(macro_file_->get_text_buffer()));
 
             // Add all copy members on which this macro is dependant
             for (const auto& copy_ptr : info->macro_definition->used_copy_members)
             {
                 const auto& file = locs.emplace_back(file_mngr_->find(copy_ptr->definition_location.resource_loc));
                 ctx.hlasm_ctx->add_copy_member(copy_ptr);
-                ctx.lsp_ctx->add_copy(copy_ptr, lsp::text_data_view(file->get_text()));
+                ctx.lsp_ctx->add_copy(copy_ptr, lsp::text_data_view(file->get_text_buffer()));
             }
         }
         else if (key.data.proc_kind == processing::processing_kind::COPY)
         {
             const auto& copy_member = std::get<context::copy_member_ptr>(cached_data->cached_member);
             ctx.hlasm_ctx->add_copy_member(copy_member);
-            ctx.lsp_ctx->add_copy(copy_member, lsp::text_data_view(macro_file_->get_text()));
+            ctx.lsp_ctx->add_copy(copy_member, lsp::text_data_view(macro_file_->get_text_buffer()));
         }
     }
     return result;
@@ -152,6 +174,65 @@ void macro_cache::save_macro(const macro_cache_key& key, const analyzer& analyze
             analyzer.context().lsp_ctx->get_macro_info(key.data.library_member, context::opcode_generation::current);
     else if (key.data.proc_kind == processing::processing_kind::COPY)
         cache_data.cached_member = analyzer.context().hlasm_ctx->get_copy_member(key.data.library_member);
+
+    if (auto previous = previous_definitions_.find(key); previous != previous_definitions_.end())
+    {
+        if (const auto* info = std::get_if<lsp::macro_info_ptr>(&cache_data.cached_member); info && *info)
+            reuse_unchanged_statements(*(*info)->macro_definition, *previous->second);
+    }
+
+    // the file has been reparsed, the previous version is not needed anymore even if the key did not match
+    release_inherited_statements();
+}
+
+void macro_cache::release_inherited_statements()
+{
+    previous_definitions_.clear();
+    previous_file_.reset();
+}
+
+void macro_cache::inherit_statements_from(const macro_cache& previous)
+{
+    for (const auto& [key, data] : previous.cache_)
+    {
+        if (key.data.proc_kind != processing::processing_kind::MACRO)
+            continue;
+        if (const auto& info = std::get<lsp::macro_info_ptr>(data.cached_member); info && info->macro_definition)
+            previous_definitions_.try_emplace(key, info->macro_definition);
+    }
+    if (!previous_definitions_.empty())
+        previous_file_ = previous.macro_file_;
+}
+
+void macro_cache::reuse_unchanged_statements(
+    context::macro_definition& current, const context::macro_definition& previous) const
+{
+    if (!previous_file_ || current.definition_location.resource_loc != previous.definition_location.resource_loc)
+        return;
+
+    const lsp::text_data_view current_text(macro_file_->get_text_buffer());
+    const lsp::text_data_view previous_text(previous_file_->get_text_buffer());
+
+    const auto count = std::min(current.cached_definition.size(), previous.cached_definition.size());
+    for (size_t i = 0; i < count; ++i)
+    {
+        // statements coming from copy members are versioned separately
+        if (current.copy_nests[i].size() != 1 || previous.copy_nests[i].size() != 1)
+            continue;
+
+        const auto& current_stmt = current.cached_definition[i];
+        const auto& previous_stmt = previous.cached_definition[i];
+        const auto line = current_stmt.get_base()->statement_position().line;
+        if (current_stmt.get_base()->statement_position() != previous_stmt.get_base()->statement_position())
+            continue;
+
+        // the statement is identical only if all its lines (including continuations and comments) are the same
+        if (line_block(current_text, line, next_statement_line(current, i, current_text))
+            != line_block(previous_text, line, next_statement_line(previous, i, previous_text)))
+            continue;
+
+        current.cached_definition[i] = previous_stmt;
+    }
 }
 
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -93,6 +93,10 @@ class macro_cache final
     const file_manager* file_mngr_;
     std::shared_ptr<file> macro_file_;
 
+    // definitions from the previous version of the file, used to carry over the statements that did not change
+    std::map<macro_cache_key, context::macro_def_ptr> previous_definitions_;
+    std::shared_ptr<file> previous_file_;
+
 public:
     macro_cache(const file_manager& file_mngr, std::shared_ptr<file> macro_file);
     // Checks whether any dependencies with specified macro cache key (macro context) have changed. If not, loads the
@@ -101,9 +105,23 @@ public:
         const macro_cache_key& key, const analyzing_context& ctx) const;
     void save_macro(const macro_cache_key& key, const analyzer& analyzer);
 
+    // Remembers macro definitions of a cache built for a previous version of the same file. Statements that are
+    // unchanged in the new version keep their already reparsed forms when the macro is saved again. The definitions
+    // are released by the next save.
+    void inherit_statements_from(const macro_cache& previous);
+    void release_inherited_statements();
+
+    // test only
+    bool has_inherited_statements() const { return previous_file_ != nullptr; }
+
+    // version of the file the cache was created for
+    const std::shared_ptr<file>& get_file() const { return macro_file_; }
+
 private:
     [[nodiscard]] const macro_cache_data* find_cached_data(const macro_cache_key& key) const;
     [[nodiscard]] version_stamp get_copy_member_versions(context::macro_definition& ctx) const;
+    void reuse_unchanged_statements(
+        context::macro_definition& current, const context::macro_definition& previous) const;
 };
 
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -24,7 +24,7 @@ utils::value_task<bool> empty_parse_lib_provider::parse_library(std::string, ana
     co_return false;
 };
 bool empty_parse_lib_provider::has_library(std::string_view, utils::resource::resource_location*) { return false; };
-utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>>
+utils::value_task<std::optional<std::pair<std::shared_ptr<const text_buffer>, utils::resource::resource_location>>>
 empty_parse_lib_provider::get_library(std::string)
 {
     co_return std::nullopt;
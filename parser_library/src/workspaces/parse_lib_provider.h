@@ -17,6 +17,7 @@
 
 #include <compare>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -29,6 +30,7 @@
 #include "utils/task.h"
 
 namespace hlasm_plugin::parser_library::workspaces {
+struct text_buffer;
 
 struct library_data
 {
@@ -49,7 +51,9 @@ public:
 
     virtual bool has_library(std::string_view library, utils::resource::resource_location* url) = 0;
 
-    [[nodiscard]] virtual utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>>
+    // Returns the text of the library shared with the file manager.
+    [[nodiscard]] virtual utils::value_task<
+        std::optional<std::pair<std::shared_ptr<const text_buffer>, utils::resource::resource_location>>>
     get_library(std::string library) = 0;
 
 protected:
@@ -62,8 +66,9 @@ class empty_parse_lib_provider final : public parse_lib_provider
 public:
     [[nodiscard]] utils::value_task<bool> parse_library(std::string, analyzing_context, library_data) override;
     bool has_library(std::string_view, utils::resource::resource_location*) override;
-    [[nodiscard]] utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>>
-        get_library(std::string) override;
+    [[nodiscard]] utils::value_task<
+        std::optional<std::pair<std::shared_ptr<const text_buffer>, utils::resource::resource_location>>>
+    get_library(std::string) override;
 
     static empty_parse_lib_provider instance;
 };
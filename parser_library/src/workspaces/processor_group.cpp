@@ -48,6 +48,23 @@ std::vector<preprocessor_options> translate_pp_configs(const std::vector<config:
 }
 } // namespace
 
+library_member_index::library_member_index(std::vector<std::shared_ptr<library>> libs)
+    : m_libs(std::move(libs))
+{}
+
+const utils::resource::resource_location& library_member_index::find(std::string_view member)
+{
+    if (auto it = m_members.find(member); it != m_members.end())
+        return it->second;
+
+    utils::resource::resource_location url;
+    if (std::none_of(
+            m_libs.begin(), m_libs.end(), [&url, member](const auto& lib) { return lib->has_file(member, &url); }))
+        url = utils::resource::resource_location();
+
+    return m_members.try_emplace(std::string(member), std::move(url)).first->second;
+}
+
 processor_group::processor_group(const std::string& pg_name,
     const config::assembler_options& asm_options,
     const std::vector<config::preprocessor_options>& pp)
@@ -80,7 +97,18 @@ void processor_group::generate_suggestions(bool force)
     }
 }
 
-void processor_group::invalidate_suggestions() { m_suggestions.reset(); }
+void processor_group::invalidate_library_caches()
+{
+    m_suggestions.reset();
+    m_member_index.reset();
+}
+
+std::shared_ptr<library_member_index> processor_group::member_index() const
+{
+    if (!m_member_index)
+        m_member_index = std::make_shared<library_member_index>(m_libs);
+    return m_member_index;
+}
 
 std::vector<std::pair<std::string, size_t>> processor_group::suggest(std::string_view opcode, bool extended)
 {
@@ -152,6 +180,7 @@ void processor_group::add_library(std::shared_ptr<library> library)
     auto next_id = m_libs.size();
     const auto& lib = m_libs.emplace_back(std::move(library));
     m_lib_locations[lib->get_location()] = next_id;
+    m_member_index.reset();
 }
 
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -20,6 +20,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -30,6 +31,7 @@
 #include "library.h"
 #include "preprocessor_options.h"
 #include "utils/bk_tree.h"
+#include "utils/general_hashers.h"
 #include "utils/levenshtein_distance.h"
 #include "utils/resource_location.h"
 
@@ -40,6 +42,22 @@ struct preprocessor_options;
 
 namespace hlasm_plugin::parser_library::workspaces {
 
+// Resolves member names to the first library that contains them, remembers both hits and misses
+class library_member_index
+{
+    std::vector<std::shared_ptr<library>> m_libs;
+    std::unordered_map<std::string, utils::resource::resource_location, utils::hashers::string_hasher, std::equal_to<>>
+        m_members;
+
+public:
+    explicit library_member_index(std::vector<std::shared_ptr<library>> libs);
+
+    const std::vector<std::shared_ptr<library>>& libraries() const { return m_libs; }
+
+    // empty location when the member is not present in any of the libraries
+    const utils::resource::resource_location& find(std::string_view member);
+};
+
 // Represents a named set of libraries (processor_group)
 class processor_group : public diagnosable_impl
 {
@@ -60,8 +78,11 @@ public:
 
     const std::vector<preprocessor_options>& preprocessors() const { return m_prep_opts; }
 
+    // index shared by all programs of the group, replaced when the libraries change
+    std::shared_ptr<library_member_index> member_index() const;
+
     void generate_suggestions(bool force = true);
-    void invalidate_suggestions();
+    void invalidate_library_caches();
 
     std::vector<std::pair<std::string, size_t>> suggest(std::string_view s, bool extended);
 
@@ -80,6 +101,8 @@ private:
     static constexpr size_t suggestion_limit = 32;
 
     std::optional<utils::bk_tree<std::string, utils::levenshtein_distance_t<suggestion_limit>>> m_suggestions;
+
+    mutable std::shared_ptr<library_member_index> m_member_index;
 };
 } // namespace hlasm_plugin::parser_library::workspaces
 #endif // !HLASMPLUGIN_PARSERLIBRARY_PROCESSOR_GROUP_H
@@ -16,20 +16,27 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <unordered_set>
+#include <utility>
 
 #include "analyzer.h"
 #include "context/instruction.h"
+#include "context/macro_trace.h"
 #include "fade_messages.h"
 #include "file.h"
 #include "file_manager.h"
+#include "lexing/logical_line.h"
 #include "lsp/completion_item.h"
 #include "lsp/document_symbol_item.h"
 #include "lsp/folding.h"
 #include "lsp/item_convertors.h"
 #include "lsp/lsp_context.h"
+#include "lsp/text_data_view.h"
 #include "macro_cache.h"
 #include "processing/statement_analyzers/hit_count_analyzer.h"
 #include "semantics/highlighting_info.h"
@@ -38,6 +45,7 @@
 #include "utils/levenshtein_distance.h"
 #include "utils/path_conversions.h"
 #include "utils/transform_inserter.h"
+#include "utils/unicode_text.h"
 
 using hlasm_plugin::utils::resource::resource_location;
 using hlasm_plugin::utils::resource::resource_location_hasher;
@@ -46,16 +54,27 @@ namespace hlasm_plugin::parser_library::workspaces {
 
 struct parsing_results
 {
-    semantics::lines_info hl_info;
+    semantics::packed_lines_info hl_info;
     std::shared_ptr<lsp::lsp_context> lsp_context;
     std::shared_ptr<const std::vector<fade_message_s>> fade_messages;
     performance_metrics metrics;
     std::vector<std::pair<virtual_file_handle, utils::resource::resource_location>> vf_handles;
     processing::hit_count_map hc_opencode_map;
     processing::hit_count_map hc_macro_map;
+    std::shared_ptr<const context::macro_trace> macro_trace;
 
     std::vector<diagnostic_s> opencode_diagnostics;
     std::vector<diagnostic_s> macro_diagnostics;
+    // diagnostics located in dependencies, shared with other programs
+    std::vector<dependency_diagnostics_use> dependency_diags;
+
+    size_t diagnostics_count() const
+    {
+        size_t result = opencode_diagnostics.size();
+        for (const auto& s : dependency_diags)
+            result += s.set->diags.size();
+        return result;
+    }
 };
 
 [[nodiscard]] utils::value_task<parsing_results> parse_one_file(std::shared_ptr<context::id_storage> ids,
@@ -63,7 +82,8 @@ struct parsing_results
     parse_lib_provider& lib_provider,
     asm_option asm_opts,
     std::vector<preprocessor_options> pp,
-    virtual_file_monitor* vfm)
+    virtual_file_monitor* vfm,
+    size_t macro_trace_events)
 {
     auto fms = std::make_shared<std::vector<fade_message_s>>();
     analyzer a(file->get_text(),
@@ -82,18 +102,48 @@ struct parsing_results
     processing::hit_count_analyzer hc_analyzer(a.hlasm_ctx());
     a.register_stmt_analyzer(&hc_analyzer);
 
+    if (macro_trace_events)
+        a.hlasm_ctx().enable_macro_trace(macro_trace_events);
+
     co_await a.co_analyze();
 
     a.collect_diags();
 
     parsing_results result;
     result.opencode_diagnostics = std::move(a.diags());
-    result.hl_info = a.take_semantic_tokens();
+    result.hl_info = semantics::packed_lines_info(a.take_semantic_tokens());
     result.lsp_context = a.context().lsp_ctx;
     result.fade_messages = std::move(fms);
     result.metrics = a.get_metrics();
     result.vf_handles = a.take_vf_handles();
     result.hc_opencode_map = hc_analyzer.take_hit_count_map();
+    result.macro_trace = a.hlasm_ctx().get_macro_trace();
+
+    co_return result;
+}
+
+// quick parse-only pass without libraries, configuration, preprocessors, macros and copy members
+// that reports only syntax errors
+[[nodiscard]] utils::value_task<std::vector<diagnostic_s>> parse_syntax_only(
+    std::shared_ptr<context::id_storage> ids, std::shared_ptr<file> file)
+{
+    analyzer a(file->get_text(),
+        analyzer_options {
+            file->get_location(),
+            &empty_parse_lib_provider::instance,
+            file_is_opencode::yes,
+            syntax_check_only::yes,
+            std::move(ids),
+        });
+
+    co_await a.co_analyze();
+
+    a.collect_diags();
+
+    std::vector<diagnostic_s> result;
+    std::ranges::copy_if(a.diags(), std::back_inserter(result), [](const diagnostic_s& d) {
+        return d.code.size() > 1 && d.code.front() == 'S' && isdigit((unsigned char)d.code[1]);
+    });
 
     co_return result;
 }
@@ -101,7 +151,7 @@ struct parsing_results
 struct workspace_parse_lib_provider final : public parse_lib_provider
 {
     workspace& ws;
-    std::vector<std::shared_ptr<library>> libraries;
+    std::shared_ptr<library_member_index> member_index;
     workspace::processor_file_compoments& pfc;
 
     std::map<resource_location,
@@ -113,9 +163,9 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
         current_file_map;
 
     workspace_parse_lib_provider(
-        workspace& ws, std::vector<std::shared_ptr<library>> libraries, workspace::processor_file_compoments& pfc)
+        workspace& ws, std::shared_ptr<library_member_index> member_index, workspace::processor_file_compoments& pfc)
         : ws(ws)
-        , libraries(std::move(libraries))
+        , member_index(std::move(member_index))
         , pfc(pfc)
     {}
 
@@ -133,29 +183,20 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
     resource_location get_url(std::string_view library)
     {
         if (auto it = next_member_map.find(library); it != next_member_map.end())
-        {
             return it->second;
-        }
-        else if (resource_location url; std::none_of(libraries.begin(),
-                     libraries.end(),
-                     [&url, &library](const auto& lib) { return lib->has_file(library, &url); }))
-        {
-            next_member_map.emplace(library, resource_location());
-            return resource_location();
-        }
-        else
-        {
-            next_member_map.emplace(library, url);
-            return url;
-        }
+
+        return next_member_map.emplace(library, member_index->find(library)).first->second;
     }
 
+    // the file manager requests the file immediately, only the wait for its content is deferred
     [[nodiscard]] utils::value_task<std::shared_ptr<file>> get_file(const resource_location& url)
     {
         if (auto it = current_file_map.find(url); it != current_file_map.end())
-            co_return it->second;
-        else
-            co_return current_file_map.try_emplace(url, co_await ws.file_manager_.add_file(url)).first->second;
+            return utils::value_task<std::shared_ptr<file>>::from_value(it->second);
+
+        return ws.file_manager_.add_file(url).then([this, url](std::shared_ptr<file> f) {
+            return current_file_map.try_emplace(url, std::move(f)).first->second;
+        });
     }
 
     auto& get_cache(const resource_location& url, const std::shared_ptr<file>& file)
@@ -164,11 +205,21 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
             next_dependencies
                 .try_emplace(url, utils::factory([&url, &file, this]() {
                     auto version = file->get_version();
-                    if (auto it = pfc.m_dependencies.find(url); it != pfc.m_dependencies.end()
-                        && std::get<std::shared_ptr<workspace::dependency_cache>>(it->second)->version == version)
-                        return std::get<std::shared_ptr<workspace::dependency_cache>>(it->second);
-
-                    return std::make_shared<workspace::dependency_cache>(version, ws.get_file_manager(), file);
+                    const workspace::dependency_cache* previous = nullptr;
+                    if (auto it = pfc.m_dependencies.find(url); it != pfc.m_dependencies.end())
+                    {
+                        if (const auto* dep = std::get_if<std::shared_ptr<workspace::dependency_cache>>(&it->second))
+                        {
+                            if ((*dep)->version == version)
+                                return *dep;
+                            previous = dep->get();
+                        }
+                    }
+
+                    auto result = std::make_shared<workspace::dependency_cache>(version, ws.get_file_manager(), file);
+                    if (previous)
+                        result->cache.inherit_statements_from(previous->cache);
+                    return result;
                 }))
                 .first->second)
             ->cache;
@@ -225,7 +276,7 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
         mc.save_macro(cache_key, a);
         macro_pfc.m_last_macro_analyzer_with_lsp = collect_hl;
         if (collect_hl)
-            macro_pfc.m_last_results->hl_info = a.take_semantic_tokens();
+            macro_pfc.m_last_results->hl_info = semantics::packed_lines_info(a.take_semantic_tokens());
 
         macro_pfc.m_last_results->hc_macro_map = hc_analyzer.take_hit_count_map();
 
@@ -241,19 +292,49 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
         return result;
     }
 
-    [[nodiscard]] utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>>
+    [[nodiscard]] utils::value_task<
+        std::optional<std::pair<std::shared_ptr<const text_buffer>, utils::resource::resource_location>>>
     get_library(std::string library) override
     {
-        if (auto url = get_url(library); url.empty())
-            co_return std::nullopt;
-        else
-            co_return std::make_pair((co_await get_file(url))->get_text(), std::move(url));
+        using result_t = std::optional<std::pair<std::shared_ptr<const text_buffer>, resource_location>>;
+
+        auto url = get_url(library);
+        if (url.empty())
+            return utils::value_task<result_t>::from_value(std::nullopt);
+
+        return get_file(url).then([url](std::shared_ptr<file> f) mutable -> result_t {
+            return std::make_pair(f->get_text_buffer(), std::move(url));
+        });
+    }
+
+    // moves the diagnostics located in the dependencies into sets shared with other programs
+    void share_dependency_diagnostics(
+        parsing_results& results, const resource_location& program, dependency_diagnostics_store& store) const
+    {
+        std::unordered_map<std::string_view, version_t> versions;
+        for (const auto& [loc, f] : current_file_map)
+            versions.try_emplace(loc.get_uri(), f->get_version());
+
+        std::vector<diagnostic_s> own;
+        std::map<std::string, std::vector<diagnostic_s>, std::less<>> by_dependency;
+        for (auto& d : results.opencode_diagnostics)
+        {
+            if (d.file_uri != program.get_uri() && versions.contains(d.file_uri))
+                by_dependency[d.file_uri].push_back(std::move(d));
+            else
+                own.push_back(std::move(d));
+        }
+
+        results.opencode_diagnostics = std::move(own);
+        for (auto& [uri, diags] : by_dependency)
+            results.dependency_diags.push_back(
+                store.intern(resource_location(uri), versions.at(uri), std::move(diags)));
     }
 
     [[nodiscard]] utils::task prefetch_libraries() const
     {
         std::vector<utils::task> pending_prefetches;
-        for (const auto& lib : libraries)
+        for (const auto& lib : member_index->libraries())
             if (auto p = lib->prefetch(); p.valid() && !p.done())
                 pending_prefetches.emplace_back(std::move(p));
 
@@ -311,6 +392,7 @@ void workspace::collect_diags() const
 {
     m_configuration.produce_diagnostics(*this, get_configuration_diagnostics_params());
 
+    std::vector<const dependency_diagnostics_use*> dependency_diags;
     for (const auto& [url, pfc] : m_processor_files)
     {
         if (is_dependency(url))
@@ -318,10 +400,16 @@ void workspace::collect_diags() const
                 pfc.m_last_results->macro_diagnostics.begin(),
                 pfc.m_last_results->macro_diagnostics.end());
         else
+        {
             diags().insert(diags().end(),
                 pfc.m_last_results->opencode_diagnostics.begin(),
                 pfc.m_last_results->opencode_diagnostics.end());
+            for (const auto& u : pfc.m_last_results->dependency_diags)
+                dependency_diags.push_back(&u);
+        }
     }
+
+    merge_dependency_diagnostics(diags(), dependency_diags);
 }
 
 void workspace::include_advisory_configuration_diagnostics(bool include_advisory_cfg_diags)
@@ -540,6 +628,7 @@ void workspace::delete_diags(processor_file_compoments& pfc)
     // this function just looks wrong, we delete diagnostics for dependencies
     // regardless of in what files they are used
     pfc.m_last_results->opencode_diagnostics.clear();
+    pfc.m_last_results->dependency_diags.clear();
 
     for (const auto& [dep, _] : pfc.m_dependencies)
     {
@@ -564,6 +653,11 @@ const ws_uri& workspace::uri() const { return location_.get_uri(); }
 
 utils::value_task<parse_file_result> workspace::parse_file(const resource_location& preferred_file)
 {
+    if (auto it = m_parsing_deferred.find(preferred_file); it != m_parsing_deferred.end())
+        m_parsing_pending.insert(m_parsing_deferred.extract(it));
+    else if (m_parsing_pending.empty() && !m_parsing_deferred.empty())
+        m_parsing_pending.insert(m_parsing_deferred.extract(m_parsing_deferred.begin()));
+
     if (m_parsing_pending.empty())
         return {};
 
@@ -575,13 +669,36 @@ utils::value_task<parse_file_result> workspace::parse_file(const resource_locati
     if (!comp.m_last_opencode_id_storage)
         comp.m_last_opencode_id_storage = std::make_shared<context::id_storage>();
 
+    // the quick pass does not run the preprocessors, it would report their statements as syntax errors
+    if (std::exchange(comp.m_syntax_pass_pending, false)
+        && get_preprocessor_options(comp.m_file->get_location()).empty())
+    {
+        // the file stays pending, the full analysis follows
+        return [](processor_file_compoments& comp, workspace& self) -> utils::value_task<parse_file_result> {
+            auto diags = co_await parse_syntax_only(comp.m_last_opencode_id_storage, comp.m_file);
+            if (&self.get_proc_grp(comp.m_file->get_location()) == &self.implicit_proc_grp
+                && (int64_t)diags.size() > self.get_config().diag_supress_limit)
+            {
+                diags.clear();
+                diags.push_back(diagnostic_s::info_SUP(comp.m_file->get_location()));
+            }
+            comp.m_last_results->opencode_diagnostics = std::move(diags);
+            comp.m_last_results->dependency_diags.clear();
+
+            co_return parse_file_result {
+                .filename = comp.m_file->get_location(),
+                .preliminary = true,
+            };
+        }(comp, *this);
+    }
+
     return [](processor_file_compoments& comp, workspace& self) -> utils::value_task<parse_file_result> {
         const auto& url = comp.m_file->get_location();
 
         auto config = co_await self.get_analyzer_configuration(url);
 
         comp.m_alternative_config = std::move(config.alternative_config_url);
-        workspace_parse_lib_provider ws_lib(self, std::move(config.libraries), comp);
+        workspace_parse_lib_provider ws_lib(self, std::move(config.member_index), comp);
 
         if (auto prefetch = ws_lib.prefetch_libraries(); prefetch.valid())
             co_await std::move(prefetch);
@@ -593,9 +710,11 @@ utils::value_task<parse_file_result> workspace::parse_file(const resource_locati
             ws_lib,
             std::move(config.opts),
             std::move(config.pp_opts),
-            &self.fm_vfm_);
+            &self.fm_vfm_,
+            (size_t)self.get_config().macro_trace_events.value_or(0));
         results.hc_macro_map = std::move(comp.m_last_results->hc_macro_map); // save macro stuff
         results.macro_diagnostics = std::move(comp.m_last_results->macro_diagnostics);
+        ws_lib.share_dependency_diagnostics(results, url, self.m_dependency_diagnostics);
         *comp.m_last_results = std::move(results);
 
         std::set<resource_location> files_to_close;
@@ -606,11 +725,16 @@ utils::value_task<parse_file_result> workspace::parse_file(const resource_locati
         self.filter_and_close_dependencies(std::move(files_to_close));
 
         auto [errors, warnings] = std::pair<size_t, size_t>();
-        for (const auto& d : comp.m_last_results->opencode_diagnostics)
-        {
-            errors += d.severity == diagnostic_severity::error;
-            warnings += d.severity == diagnostic_severity::warning;
-        }
+        const auto count = [&errors, &warnings](const std::vector<diagnostic_s>& diags) {
+            for (const auto& d : diags)
+            {
+                errors += d.severity == diagnostic_severity::error;
+                warnings += d.severity == diagnostic_severity::warning;
+            }
+        };
+        count(comp.m_last_results->opencode_diagnostics);
+        for (const auto& s : comp.m_last_results->dependency_diags)
+            count(s.set->diags);
 
         co_return parse_file_result {
             .filename = url,
@@ -638,8 +762,13 @@ utils::value_task<debugging::debugger_configuration> workspace::get_debugger_con
 utils::value_task<workspace::analyzer_configuration> workspace::get_analyzer_configuration(resource_location url)
 {
     auto alt_config = co_await m_configuration.load_alternative_config_if_needed(url);
+    auto libraries = get_libraries(url);
+    const auto& grp = get_proc_grp(url);
+    auto member_index =
+        libraries == grp.libraries() ? grp.member_index() : std::make_shared<library_member_index>(libraries);
     co_return analyzer_configuration {
-        .libraries = get_libraries(url),
+        .libraries = std::move(libraries),
+        .member_index = std::move(member_index),
         .opts = get_asm_options(url),
         .pp_opts = get_preprocessor_options(url),
         .alternative_config_url = std::move(alt_config),
@@ -648,8 +777,132 @@ utils::value_task<workspace::analyzer_configuration> workspace::get_analyzer_con
 
 namespace {
 bool trigger_reparse(const resource_location& file_location) { return !file_location.get_uri().starts_with("hlasm:"); }
+
+// lines [first, last) that differ between the two versions, provided that no line was added or removed
+std::optional<std::pair<size_t, size_t>> changed_lines(const file& previous, const file& current)
+{
+    const lsp::text_data_view previous_text(previous.get_text_buffer());
+    const lsp::text_data_view current_text(current.get_text_buffer());
+
+    const auto lines = previous_text.get_number_of_lines();
+    if (lines != current_text.get_number_of_lines())
+        return std::nullopt;
+
+    size_t first = 0;
+    while (first < lines && previous_text.get_line(first) == current_text.get_line(first))
+        ++first;
+    size_t last = lines;
+    while (last > first && previous_text.get_line(last - 1) == current_text.get_line(last - 1))
+        --last;
+
+    return std::make_pair(first, last);
+}
+
+std::string_view strip_line_end(std::string_view line)
+{
+    while (line.ends_with('\n') || line.ends_with('\r'))
+        line.remove_suffix(1);
+    return line;
+}
+
+bool is_comment_line(std::string_view line) { return line.starts_with('*') || line.starts_with(".*"); }
+
+bool is_continued_line(std::string_view line)
+{
+    const auto cont = utils::utf8_substr(line, lexing::default_ictl_copy.end, 1).str;
+    return !cont.empty() && cont != " ";
+}
+
+// operation field of a line, empty for comments
+std::string_view operation_field(std::string_view line)
+{
+    if (is_comment_line(line))
+        return {};
+    line = utils::utf8_substr(line, 0, lexing::default_ictl_copy.end).str;
+    if (const auto name_end = line.find(' '); name_end != std::string_view::npos)
+        line.remove_prefix(name_end);
+    else
+        return {};
+    if (const auto op_start = line.find_first_not_of(' '); op_start != std::string_view::npos)
+        line.remove_prefix(op_start);
+    else
+        return {};
+    return line.substr(0, line.find(' '));
+}
+
+bool is_operation(std::string_view op, std::string_view upper_name)
+{
+    return std::ranges::equal(op, upper_name, [](unsigned char l, unsigned char r) { return std::toupper(l) == r; });
+}
+
+// MACRO, MEND, prototype and continued lines may change the structure of a macro definition
+bool changes_macro_structure(const lsp::text_data_view& text, size_t line)
+{
+    const auto current = strip_line_end(text.get_line(line));
+    if (is_continued_line(current) || line > 0 && is_continued_line(strip_line_end(text.get_line(line - 1))))
+        return true;
+
+    if (const auto op = operation_field(current); is_operation(op, "MACRO") || is_operation(op, "MEND"))
+        return true;
+
+    // the prototype is the first statement following MACRO
+    for (auto l = line; l-- > 0;)
+    {
+        const auto previous = strip_line_end(text.get_line(l));
+        if (!is_comment_line(previous))
+            return is_operation(operation_field(previous), "MACRO");
+    }
+    return false;
+}
 } // namespace
 
+bool workspace::only_unexecuted_lines_changed(
+    const processor_file_compoments& comp, const resource_location& dependency, const file& changed_file) const
+{
+    const auto dep = comp.m_dependencies.find(dependency);
+    if (dep == comp.m_dependencies.end())
+        return false;
+    const auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep->second);
+    if (!cache)
+        return false;
+    const auto& previous_file = (*cache)->cache.get_file();
+    if (!previous_file || previous_file.get() == &changed_file)
+        return false;
+
+    const auto lines = changed_lines(*previous_file, changed_file);
+    if (!lines)
+        return false;
+
+    // the definitions are recorded when the dependency itself is analyzed, the program records what it executed
+    const auto dep_comp = m_processor_files.find(dependency);
+    if (dep_comp == m_processor_files.end())
+        return false;
+    const auto definition = dep_comp->second.m_last_results->hc_macro_map.find(dependency);
+    if (definition == dep_comp->second.m_last_results->hc_macro_map.end())
+        return false;
+    const auto& defined_lines = definition->second.hits.line_details;
+
+    const auto& program_map = comp.m_last_results->hc_opencode_map;
+    const auto executed = program_map.find(dependency);
+    const auto* executed_lines = executed == program_map.end() ? nullptr : &executed->second.hits.line_details;
+
+    // Only statements in macro bodies that the program never reached qualify. Other lines (comments, prototypes,
+    // MACRO and MEND) may change the structure of the definition and lines seen by the lookahead may provide
+    // attributes. The new version of the line is checked as well, the change itself may turn it into such a line.
+    const lsp::text_data_view new_text(changed_file.get_text_buffer());
+    for (auto l = lines->first; l < lines->second; ++l)
+    {
+        if (l >= defined_lines.size() || !defined_lines[l].contains_statement || !defined_lines[l].macro_definition)
+            return false;
+        if (changes_macro_structure(new_text, l))
+            return false;
+        if (executed_lines && l < executed_lines->size() && (*executed_lines)[l].contains_statement)
+            return false;
+    }
+
+    return true;
+}
+
 void workspace::mark_all_opened_files()
 {
     for (const auto& [fname, comp] : m_processor_files)
@@ -669,12 +922,26 @@ utils::task workspace::mark_file_for_parsing(
 
     if (file_content_status == file_content_state::changed_content && trigger_reparse(file_location))
     {
+        std::shared_ptr<file> changed_file;
         for (auto& [_, component] : m_processor_files)
         {
             if (!component.m_opened)
                 continue;
-            if (component.m_dependencies.contains(file_location))
-                m_parsing_pending.emplace(component.m_file->get_location());
+            if (!component.m_dependencies.contains(file_location))
+                continue;
+
+            const auto& url = component.m_file->get_location();
+            if (!changed_file)
+                changed_file = file_manager_.find(file_location);
+
+            if (!m_parsing_pending.contains(url) && changed_file
+                && only_unexecuted_lines_changed(component, file_location, *changed_file))
+                m_parsing_deferred.emplace(url);
+            else
+            {
+                m_parsing_pending.emplace(url);
+                m_parsing_deferred.erase(url);
+            }
         }
     }
 
@@ -703,11 +970,12 @@ workspace_file_info workspace::parse_successful(processor_file_compoments& comp,
 
     comp.m_collect_perf_metrics = false; // only on open/first parsing
     m_parsing_pending.erase(comp.m_file->get_location());
+    m_parsing_deferred.erase(comp.m_file->get_location());
 
     const processor_group& grp = get_proc_grp(comp.m_file->get_location());
     ws_file_info.processor_group_found = &grp != &implicit_proc_grp;
     if (&grp == &implicit_proc_grp
-        && (int64_t)comp.m_last_results->opencode_diagnostics.size() > get_config().diag_supress_limit)
+        && (int64_t)comp.m_last_results->diagnostics_count() > get_config().diag_supress_limit)
     {
         ws_file_info.diagnostics_suppressed = true;
         delete_diags(comp);
@@ -719,6 +987,11 @@ workspace_file_info workspace::parse_successful(processor_file_compoments& comp,
 
     ws_file_info.files_processed = libs.next_dependencies.size() + 1; // TODO: identify error states?
 
+    // dependencies that were not reparsed do not need the previous versions either
+    for (const auto& [_, dep] : libs.next_dependencies)
+        if (const auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep))
+            (*cache)->cache.release_inherited_statements();
+
     comp.m_dependencies = std::move(libs.next_dependencies);
     comp.m_member_map = std::move(libs.next_member_map);
 
@@ -732,6 +1005,7 @@ utils::task workspace::did_open_file(resource_location file_location, file_conte
         auto& file = co_await add_processor_file_impl(co_await file_manager_.add_file(file_location));
         file.m_opened = true;
         file.m_collect_perf_metrics = true;
+        file.m_syntax_pass_pending = get_config().fast_syntax_diagnostics.value_or(false);
         m_parsing_pending.emplace(file_location);
         if (auto t = mark_file_for_parsing(file_location, file_content_status); t.valid())
             co_await std::move(t);
@@ -753,6 +1027,7 @@ utils::task workspace::did_close_file(resource_location file_location)
 
     fcomp->second.m_opened = false;
     m_parsing_pending.erase(file_location);
+    m_parsing_deferred.erase(file_location);
 
     bool found_dependency = false;
     // first check whether the file is a dependency
@@ -931,7 +1206,7 @@ std::vector<token_info> workspace::semantic_tokens(const resource_location& docu
     if (!comp)
         return {};
 
-    return comp->m_last_results->hl_info;
+    return comp->m_last_results->hl_info.unpack();
 }
 
 std::vector<branch_info> workspace::branch_information(const resource_location& document_loc) const
@@ -970,6 +1245,15 @@ std::optional<performance_metrics> workspace::last_metrics(const resource_locati
     return comp->m_last_results->metrics;
 }
 
+std::string workspace::macro_trace(const resource_location& document_loc, macro_trace_format format) const
+{
+    auto comp = find_processor_file_impl(document_loc);
+    if (!comp || !comp->m_last_results->macro_trace)
+        return {};
+
+    return context::export_macro_trace(*comp->m_last_results->macro_trace, format);
+}
+
 utils::task workspace::open()
 {
     opened_ = true;
@@ -1004,6 +1288,8 @@ const processor_group& workspace::get_proc_grp(const resource_location& file) co
 
 const processor_group& workspace::get_proc_grp(const proc_grp_id& id) const { return m_configuration.get_proc_grp(id); }
 
+bool workspace::is_parsing_deferred(const resource_location& file) const { return m_parsing_deferred.contains(file); }
+
 namespace {
 auto generate_instruction_bk_tree(instruction_set_version version)
 {
@@ -30,6 +30,7 @@
 
 #include "branch_info.h"
 #include "debugging/debugger_configuration.h"
+#include "dependency_diagnostics.h"
 #include "diagnosable_impl.h"
 #include "file_manager_vfm.h"
 #include "folding_range.h"
@@ -59,6 +60,8 @@ struct parse_file_result
     std::optional<performance_metrics> metrics_to_report;
     size_t errors = 0;
     size_t warnings = 0;
+    // only syntax diagnostics are available, the full analysis is still pending
+    bool preliminary = false;
 };
 // Represents a LSP workspace. It solves all dependencies between files -
 // implements parse lib provider and decides which files are to be parsed
@@ -121,6 +124,9 @@ public:
 
     std::optional<performance_metrics> last_metrics(const resource_location& document_loc) const;
 
+    // empty when the macro trace was not enabled during the last analysis
+    std::string macro_trace(const resource_location& document_loc, macro_trace_format format) const;
+
     virtual std::vector<std::shared_ptr<library>> get_libraries(const resource_location& file_location) const;
     virtual asm_option get_asm_options(const resource_location& file_location) const;
     virtual std::vector<preprocessor_options> get_preprocessor_options(const resource_location& file_location) const;
@@ -137,6 +143,7 @@ public:
 
     const processor_group& get_proc_grp(const resource_location& file) const;
     const processor_group& get_proc_grp(const proc_grp_id& id) const; // test only
+    bool is_parsing_deferred(const resource_location& file) const; // test only
 
     std::vector<std::pair<std::string, size_t>> make_opcode_suggestion(
         const resource_location& file, std::string_view opcode, bool extended);
@@ -170,6 +177,8 @@ private:
 
     bool m_include_advisory_cfg_diags;
 
+    dependency_diagnostics_store m_dependency_diagnostics;
+
     struct dependency_cache
     {
         dependency_cache(version_t version, const file_manager& fm, std::shared_ptr<file> file)
@@ -193,6 +202,7 @@ private:
 
         bool m_opened = false;
         bool m_collect_perf_metrics = false;
+        bool m_syntax_pass_pending = false;
 
         std::shared_ptr<context::id_storage> m_last_opencode_id_storage;
         bool m_last_opencode_analyzer_with_lsp = false;
@@ -210,6 +220,8 @@ private:
 
     std::unordered_map<resource_location, processor_file_compoments, resource_location_hasher> m_processor_files;
     std::unordered_set<resource_location, resource_location_hasher> m_parsing_pending;
+    // programs affected only by dependency changes in code they never executed, parsed after all pending ones
+    std::unordered_set<resource_location, resource_location_hasher> m_parsing_deferred;
 
     configuration_diagnostics_parameters get_configuration_diagnostics_params() const;
 
@@ -218,6 +230,8 @@ private:
     friend struct workspace_parse_lib_provider;
     workspace_file_info parse_successful(processor_file_compoments& comp, workspace_parse_lib_provider libs);
     void delete_diags(processor_file_compoments& pfc);
+    bool only_unexecuted_lines_changed(
+        const processor_file_compoments& comp, const resource_location& dependency, const file& changed_file) const;
 
     std::vector<const processor_file_compoments*> find_related_opencodes(const resource_location& document_loc) const;
     void filter_and_close_dependencies(std::set<resource_location> files_to_close_candidates,
@@ -226,6 +240,7 @@ private:
     struct analyzer_configuration
     {
         std::vector<std::shared_ptr<workspaces::library>> libraries;
+        std::shared_ptr<library_member_index> member_index;
         asm_option opts;
         std::vector<preprocessor_options> pp_opts;
         resource_location alternative_config_url;
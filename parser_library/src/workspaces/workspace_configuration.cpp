@@ -841,10 +841,10 @@ utils::value_task<std::optional<std::vector<const processor_group*>>> workspace_
             }
         }
         if (!pending_refresh)
-            proc_grp.invalidate_suggestions();
+            proc_grp.invalidate_library_caches();
         else
             pending_refreshes.emplace_back([](auto& pg) -> utils::task {
-                pg.invalidate_suggestions();
+                pg.invalidate_library_caches();
                 co_return;
             }(proc_grp));
     }
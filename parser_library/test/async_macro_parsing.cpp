@@ -17,6 +17,7 @@
 #include "common_testing.h"
 #include "utils/general_hashers.h"
 #include "utils/task.h"
+#include "workspaces/file.h"
 
 using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::utils;
@@ -59,11 +60,11 @@ struct async_macro_parsing_fixture : ::testing::Test, parse_lib_provider
             *url = resource::resource_location(it->second);
         return true;
     }
-    value_task<std::optional<std::pair<std::string, resource::resource_location>>> get_library(
-        std::string library) override
+    value_task<std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, resource::resource_location>>>
+    get_library(std::string library) override
     {
         if (auto it = m_files.find(library); it != m_files.end())
-            co_return std::make_pair(it->second, resource::resource_location(it->first));
+            co_return std::make_pair(workspaces::make_text_buffer(it->second), resource::resource_location(it->first));
         else
             co_return std::nullopt;
     }
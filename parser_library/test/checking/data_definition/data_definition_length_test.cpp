@@ -753,3 +753,19 @@ TEST(data_def_length, LQ)
 
     EXPECT_EQ(t.get_length(op), 16U * 8);
 }
+
+TEST(data_def_length, nominal_summary)
+{
+    data_def_type_X t;
+
+    data_definition_operand op = setup_data_def_op('X', '\0', "0102,03");
+
+    const auto summary = t.summarize_nominal(reduce_nominal_value(op.nominal_value));
+    EXPECT_EQ(summary.values, 2U);
+    EXPECT_EQ(summary.nominal_length, 3U);
+    EXPECT_EQ(t.get_length(op.dupl_factor, op.length, summary), t.get_length(op));
+
+    data_def_field<int32_t> dupl(100);
+    data_def_length_t length(data_def_field<int32_t>(5));
+    EXPECT_EQ(t.get_length(dupl, length, summary), 100U * 2 * 5 * 8);
+}
@@ -66,3 +66,34 @@ TEST(address, has_unresolved_spaces)
 
     ASSERT_FALSE(addr.has_unresolved_space());
 }
+
+TEST(address, spaces_resolved_out_of_order)
+{
+    hlasm_context ctx;
+    ctx.ord_ctx.set_section(id_index("TEST"), section_kind::DUMMY, location(), library_info_transitional::empty);
+    auto& loctr = ctx.ord_ctx.current_section()->current_location_counter();
+
+    std::vector<space_ptr> spaces;
+    for (int i = 0; i < 4; ++i)
+    {
+        spaces.push_back(loctr.register_ordinary_space(no_align));
+        loctr.reserve_storage_area(2, no_align);
+    }
+
+    auto addr = loctr.current_address();
+
+    space::resolve(spaces[2], 3);
+    space::resolve(spaces[0], 1);
+    space::resolve(spaces[3], 4);
+
+    EXPECT_TRUE(addr.has_unresolved_space());
+    EXPECT_TRUE(loctr.has_unresolved_spaces());
+
+    space::resolve(spaces[1], 2);
+
+    EXPECT_FALSE(addr.has_unresolved_space());
+    EXPECT_FALSE(loctr.has_unresolved_spaces());
+    EXPECT_EQ(addr.offset(), 18);
+    EXPECT_EQ(loctr.storage(), 18U);
+    EXPECT_EQ(loctr.current_address().offset(), 18);
+}
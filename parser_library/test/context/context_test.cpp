@@ -157,6 +157,27 @@ TEST(context, OPSYN)
     EXPECT_EQ(ctx.get_operation_code(mvc).opcode, mvc);
 }
 
+TEST(context, OPSYN_isolated)
+{
+    hlasm_context ctx1;
+    hlasm_context ctx2;
+
+    auto lr = ctx1.ids().add(std::string_view("LR"));
+    auto st = ctx1.ids().add(std::string_view("ST"));
+
+    ctx1.add_mnemonic(lr, st);
+    EXPECT_EQ(ctx1.get_operation_code(lr).opcode, st);
+    EXPECT_EQ(ctx1.opcode_mnemo_storage().size(), 1);
+
+    // the instruction table is shared, the mnemonics are not
+    EXPECT_EQ(ctx2.get_operation_code(lr).opcode, lr);
+    EXPECT_TRUE(ctx2.opcode_mnemo_storage().empty());
+
+    ctx1.remove_mnemonic(lr);
+    EXPECT_FALSE(ctx1.find_any_valid_opcode(lr));
+    EXPECT_TRUE(ctx2.find_any_valid_opcode(lr));
+}
+
 TEST(context_set_vars, set_scalar)
 {
     hlasm_context ctx;
@@ -12,6 +12,9 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <atomic>
+#include <string>
+
 #include "gtest/gtest.h"
 
 #include "../common_testing.h"
@@ -659,3 +662,31 @@ TEST(literals, suppress_messages_from_DTO_attributes)
     EXPECT_EQ(get_var_value<context::C_t>(a.hlasm_ctx(), "XT"), "U");
     EXPECT_EQ(get_var_value<context::C_t>(a.hlasm_ctx(), "XO"), "U");
 }
+
+TEST(literals, pool_generation_at_end_yields)
+{
+    constexpr size_t count = 50;
+    std::string instructions;
+    for (size_t i = 0; i < count; ++i)
+        instructions.append("    L   1,=F'").append(std::to_string(i)).append("'\n");
+
+    const auto count_slices = [](std::string input) {
+        analyzer a(input);
+        std::atomic<unsigned char> yield_indicator = 1;
+        auto t = a.co_analyze();
+        size_t slices = 0;
+        while (!t.done())
+        {
+            t.resume(&yield_indicator);
+            ++slices;
+        }
+        EXPECT_TRUE(a.diags().empty());
+        return slices;
+    };
+
+    // LTORG generates the pool in a single step
+    const auto explicit_pool = count_slices(instructions + "    LTORG\n");
+    const auto pool_at_end = count_slices(instructions);
+
+    EXPECT_GE(pool_at_end, explicit_pool + count);
+}
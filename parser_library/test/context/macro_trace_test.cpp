@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "gtest/gtest.h"
+
+#include "../common_testing.h"
+#include "../workspace/empty_configs.h"
+#include "context/hlasm_context.h"
+#include "context/macro_trace.h"
+#include "lib_config.h"
+#include "nlohmann/json.hpp"
+#include "utils/resource_location.h"
+#include "workspaces/file_manager_impl.h"
+#include "workspaces/workspace.h"
+
+namespace {
+const std::string nested_macros = R"(
+         MACRO
+         INNER
+         MEND
+         MACRO
+         OUTER
+         INNER
+         INNER
+         MEND
+         OUTER
+)";
+} // namespace
+
+TEST(macro_trace, disabled_by_default)
+{
+    analyzer a(nested_macros);
+    a.analyze();
+
+    EXPECT_FALSE(a.hlasm_ctx().get_macro_trace());
+}
+
+TEST(macro_trace, nested_invocations)
+{
+    analyzer a(nested_macros);
+    a.hlasm_ctx().enable_macro_trace(100);
+    a.analyze();
+
+    const auto trace = a.hlasm_ctx().get_macro_trace();
+    ASSERT_TRUE(trace);
+
+    const auto events = trace->events();
+    ASSERT_EQ(events.size(), 6);
+
+    using enum context::macro_trace_event_kind;
+    const std::vector<std::tuple<std::string_view, context::macro_trace_event_kind, size_t>> expected {
+        { "OUTER", enter, 1 },
+        { "INNER", enter, 2 },
+        { "INNER", exit, 2 },
+        { "INNER", enter, 2 },
+        { "INNER", exit, 2 },
+        { "OUTER", exit, 1 },
+    };
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const auto& [name, kind, depth] = expected[i];
+        EXPECT_EQ(events[i].name.to_string_view(), name);
+        EXPECT_EQ(events[i].kind, kind);
+        EXPECT_EQ(events[i].depth, depth);
+    }
+    EXPECT_EQ(events[0].call_line, 9);
+    EXPECT_EQ(events[1].call_line, 6);
+    EXPECT_LT(events[0].statements, events[5].statements);
+    EXPECT_EQ(trace->dropped(), 0);
+
+    const auto folded = context::to_folded_stacks(*trace);
+    EXPECT_NE(folded.find("OUTER "), std::string::npos);
+    EXPECT_NE(folded.find("OUTER;INNER "), std::string::npos);
+
+    const auto chrome = nlohmann::json::parse(context::to_chrome_trace(*trace));
+    EXPECT_EQ(chrome.at("traceEvents").size(), 6);
+    EXPECT_EQ(chrome.at("traceEvents").at(0).at("ph"), "B");
+    EXPECT_EQ(chrome.at("traceEvents").at(5).at("ph"), "E");
+}
+
+TEST(macro_trace, ring_buffer_keeps_latest_events)
+{
+    analyzer a(nested_macros);
+    a.hlasm_ctx().enable_macro_trace(4);
+    a.analyze();
+
+    const auto trace = a.hlasm_ctx().get_macro_trace();
+    ASSERT_TRUE(trace);
+
+    const auto events = trace->events();
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(trace->dropped(), 2);
+    EXPECT_EQ(events.front().name.to_string_view(), "INNER");
+    EXPECT_EQ(events.front().kind, context::macro_trace_event_kind::exit);
+    EXPECT_EQ(events.back().name.to_string_view(), "OUTER");
+    EXPECT_EQ(events.back().kind, context::macro_trace_event_kind::exit);
+
+    // unmatched exits are skipped
+    EXPECT_EQ(context::to_folded_stacks(*trace).find("OUTER;"), std::string::npos);
+}
+
+TEST(macro_trace, exported_after_analysis)
+{
+    using hlasm_plugin::utils::resource::resource_location;
+
+    const resource_location file_loc("trace_file");
+    workspaces::file_manager_impl fm;
+    fm.did_open_file(empty_pgm_conf_name, 0, empty_pgm_conf);
+    fm.did_open_file(empty_proc_grps_name, 0, empty_proc_grps);
+    fm.did_open_file(file_loc, 0, R"(
+         MACRO
+         INNER_MACRO_WITH_A_LONG_NAME
+         MEND
+         INNER_MACRO_WITH_A_LONG_NAME
+)");
+
+    auto config = lib_config::load_from_json(R"({"macroTraceEvents":100})"_json);
+    shared_json global_settings = make_empty_shared_json();
+
+    workspaces::workspace ws(empty_ws, fm, config, global_settings);
+    ws.open().run();
+    run_if_valid(ws.did_open_file(file_loc));
+    parse_all_files(ws);
+
+    // the analyzer and its context are gone by now
+    const auto chrome = nlohmann::json::parse(ws.macro_trace(file_loc, macro_trace_format::chrome_trace));
+    const auto& events = chrome.at("traceEvents");
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events.at(0).at("name"), "INNER_MACRO_WITH_A_LONG_NAME");
+    const auto call_site = events.at(0).at("args").at("call_site").get<std::string>();
+    EXPECT_TRUE(call_site.ends_with("trace_file:5")) << call_site;
+    EXPECT_EQ(events.at(1).at("name"), "INNER_MACRO_WITH_A_LONG_NAME");
+}
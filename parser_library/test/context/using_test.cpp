@@ -94,6 +94,7 @@ struct test_context : public dependency_solver
         return get_symbol(name);
     }
     std::string get_opcode_attr(id_index name) const { return hlasm_ctx.get_opcode_attr(name); }
+    const evaluation_epoch* get_evaluation_epoch() const override { return nullptr; }
 };
 
 std::unique_ptr<mach_expression> operator+(std::unique_ptr<mach_expression> l, std::unique_ptr<mach_expression> r)
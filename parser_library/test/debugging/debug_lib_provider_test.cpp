@@ -24,6 +24,7 @@
 #include "debugging/debug_lib_provider.h"
 #include "utils/resource_location.h"
 #include "utils/task.h"
+#include "workspaces/file.h"
 
 using namespace ::testing;
 using namespace hlasm_plugin::parser_library;
@@ -84,9 +85,11 @@ TEST_F(debug_lib_provider_test, get_library)
     EXPECT_CALL(*mock_lib, has_file(Eq("AAA"), _)).WillOnce(DoAll(SetArgPointee<1>(aaa_location), Return(true)));
     EXPECT_CALL(*mock_lib, has_file(Eq("BBB"), _)).WillOnce(Return(false));
 
-    std::optional<std::pair<std::string, resource_location>> result;
-
-    EXPECT_EQ(lib.get_library("AAA").run().value(), std::pair(aaa_content, aaa_location));
+    auto result = lib.get_library("AAA").run().value();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->first->text, aaa_content);
+    EXPECT_EQ(result->first->line_indices, std::vector<size_t> { 0 });
+    EXPECT_EQ(result->second, aaa_location);
 
     EXPECT_EQ(lib.get_library("BBB").run().value(), std::nullopt);
 }
@@ -134,6 +134,59 @@ TEST(debugger, stopped_on_entry)
     m.wait_for_exited();
 }
 
+TEST(debugger, variables_paging)
+{
+    file_manager_impl file_manager;
+    NiceMock<debugger_configuration_provider_mock> dc_provider;
+    EXPECT_CALL(dc_provider, provide_debugger_configuration).WillRepeatedly(Invoke([&file_manager](auto, auto r) {
+        r.provide({ .fm = &file_manager });
+    }));
+
+    debugger d;
+    debug_event_consumer_s_mock m(d);
+    std::string file_name = "test_workspace\\test";
+    resource_location file_loc(file_name);
+
+    file_manager.did_open_file(file_loc, 0, R"(C EQU 3
+A EQU 1
+B EQU 2
+ LR 1,2)");
+
+    auto [resp, mock] = make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<bool>>);
+    EXPECT_CALL(*mock, provide(true));
+    d.launch(file_name.c_str(), dc_provider, true, resp);
+    m.wait_for_stopped();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        d.next();
+        m.wait_for_stopped();
+    }
+
+    auto frames = d.stack_frames();
+    ASSERT_EQ(frames.size(), 1U);
+    auto sc = d.scopes(frames.item(0).id);
+    ASSERT_EQ(sc.size(), 3U);
+    EXPECT_EQ(sc.item(1).named_variables, 0U);
+    const auto ords = sc.item(2);
+    EXPECT_EQ(ords.named_variables, 3U);
+
+    const auto names = [&d](var_reference_t ref, size_t start, size_t count) {
+        std::vector<std::string> result;
+        for (const auto& v : d.variables(ref, start, count))
+            result.emplace_back(std::string_view(v.name));
+        return result;
+    };
+
+    EXPECT_EQ(names(ords.variable_reference, 0, 0), (std::vector<std::string> { "A", "B", "C" }));
+    EXPECT_EQ(names(ords.variable_reference, 1, 1), (std::vector<std::string> { "B" }));
+    EXPECT_EQ(names(ords.variable_reference, 2, 5), (std::vector<std::string> { "C" }));
+    EXPECT_TRUE(names(ords.variable_reference, 5, 1).empty());
+
+    d.next();
+    m.wait_for_exited();
+}
+
 TEST(debugger, disconnect)
 {
     file_manager_impl file_manager;
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "document.h"
+
+using namespace hlasm_plugin::parser_library;
+
+TEST(document, original_lines)
+{
+    const std::string_view text = "A\r\nB\nC";
+    document doc(text);
+
+    ASSERT_EQ(doc.size(), 3);
+    EXPECT_EQ(doc.at(0).text(), "A\r\n");
+    EXPECT_EQ(doc.at(1).text(), "B\n");
+    EXPECT_EQ(doc.at(2).text(), "C");
+    EXPECT_EQ(doc.at(2).lineno(), 2);
+    EXPECT_TRUE(doc.at(1).is_original());
+
+    // no copies of the source are made
+    EXPECT_EQ(doc.at(1).text().data(), text.data() + 3);
+
+    EXPECT_EQ(doc.text(), "A\r\nB\nC\n");
+}
+
+TEST(document, empty)
+{
+    document doc("");
+
+    ASSERT_EQ(doc.size(), 1);
+    EXPECT_EQ(doc.at(0).text(), "");
+    EXPECT_EQ(doc.text(), "\n");
+}
+
+TEST(document, mixed_lines)
+{
+    const std::string_view text = "A\nB\n";
+    document input(text);
+
+    std::vector<document_line> lines;
+    lines.emplace_back(input.at(0));
+    lines.emplace_back(replaced_line { "X\n" });
+    lines.emplace_back(replaced_line { "YY\n" });
+    lines.emplace_back(input.at(1));
+    document doc(std::move(lines));
+
+    ASSERT_EQ(doc.size(), 4);
+    EXPECT_EQ(doc.at(0).lineno(), 0);
+    EXPECT_EQ(doc.at(1).lineno(), std::nullopt);
+    EXPECT_FALSE(doc.at(2).is_original());
+    EXPECT_EQ(doc.at(3).lineno(), 1);
+    EXPECT_EQ(doc.at(3).text().data(), text.data() + 2);
+    EXPECT_TRUE(doc.at(1).same_type(doc.at(2)));
+    EXPECT_FALSE(doc.at(0).same_type(doc.at(1)));
+
+    // replaced lines share a single buffer
+    EXPECT_EQ(doc.at(1).text().data() + 2, doc.at(2).text().data());
+
+    EXPECT_EQ(doc.text(), "A\nX\nYY\nB\n");
+
+    const document copy(doc);
+    const document moved(std::move(doc));
+    EXPECT_EQ(copy.text(), "A\nX\nYY\nB\n");
+    EXPECT_EQ(moved.text(), "A\nX\nYY\nB\n");
+    EXPECT_NE(copy.at(1).text().data(), moved.at(1).text().data());
+    EXPECT_EQ(copy.at(3).text().data(), moved.at(3).text().data());
+}
+
+TEST(document, convert_to_replaced)
+{
+    const std::string_view text = "A\nB";
+    document doc(text);
+    doc.convert_to_replaced();
+
+    ASSERT_EQ(doc.size(), 2);
+    EXPECT_FALSE(doc.at(0).is_original());
+    EXPECT_FALSE(doc.at(1).lineno().has_value());
+    EXPECT_EQ(doc.at(1).text(), "B");
+
+    std::vector<document_line> lines(doc.begin(), doc.end());
+    EXPECT_FALSE(lines.front().is_original());
+    EXPECT_EQ(lines.back().text(), "B");
+}
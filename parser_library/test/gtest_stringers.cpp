@@ -48,7 +48,11 @@ std::ostream& operator<<(std::ostream& stream, const performance_metrics& item)
                   << "\n macro statements: " << item.macro_statements
                   << "\n non continued statements: " << item.non_continued_statements
                   << "\n open code statements: " << item.open_code_statements
-                  << "\n reparsed statements: " << item.reparsed_statements << "\n";
+                  << "\n reparsed statements: " << item.reparsed_statements
+                  << "\n opcode cache hits: " << item.opcode_cache_hits
+                  << "\n opcode cache misses: " << item.opcode_cache_misses
+                  << "\n mach evaluation cache hits: " << item.mach_evaluation_cache_hits
+                  << "\n mach evaluation cache misses: " << item.mach_evaluation_cache_misses << "\n";
 }
 
 } // namespace hlasm_plugin::parser_library
@@ -58,7 +62,7 @@ namespace hlasm_plugin::parser_library::lsp {
 std::ostream& operator<<(std::ostream& stream, const symbol_occurrence& item)
 {
     return stream << "{ kind: " << (int)item.kind << "\n name: " << item.name.to_string_view()
-                  << "\n range: " << item.occurrence_range << " }";
+                  << "\n range: " << range(item.occurrence_range) << " }";
 }
 
 std::ostream& operator<<(std::ostream& stream, const lsp::completion_item_s& item)
@@ -12,9 +12,12 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 
 #include "analyzer_fixture.h"
+#include "lsp/completion_item.h"
 #include "lsp/item_convertors.h"
 #include "lsp/lsp_context.h"
 #include "workspaces/workspace.h"
@@ -80,6 +83,26 @@ TEST_F(lsp_context_macro_documentation, hover)
     EXPECT_EQ(res, macro_documentation);
 }
 
+TEST_F(lsp_context_macro_documentation, hover_repeated)
+{
+    EXPECT_EQ(a.context().lsp_ctx->hover(opencode_loc, { 10, 8 }), macro_documentation);
+    EXPECT_EQ(a.context().lsp_ctx->hover(opencode_loc, { 10, 9 }), macro_documentation);
+}
+
+TEST_F(lsp_context_macro_documentation, completion_matches_hover)
+{
+    auto res_v = a.context().lsp_ctx->completion(opencode_loc, { 11, 1 }, '\0', completion_trigger_kind::invoked);
+
+    ASSERT_TRUE(std::holds_alternative<completion_list_instructions>(res_v));
+
+    auto items = generate_completion(res_v);
+    auto mac = std::find_if(items.begin(), items.end(), [](const auto& i) { return i.label == "MAC"; });
+    ASSERT_NE(mac, items.end());
+    EXPECT_EQ(mac->documentation, macro_documentation);
+
+    EXPECT_EQ(a.context().lsp_ctx->hover(opencode_loc, { 10, 8 }), macro_documentation);
+}
+
 TEST_F(lsp_context_macro_documentation, completion)
 {
     auto res_v = a.context().lsp_ctx->completion(opencode_loc, { 11, 1 }, '\0', completion_trigger_kind::invoked);
@@ -161,3 +161,32 @@ TEST_F(benchmark_test, lookahead_statements)
     // 2 lines skipped by lookahead + 1 which finds the symbol
     EXPECT_EQ(a->get_metrics().lookahead_statements, (size_t)3);
 }
+
+TEST_F(benchmark_test, opcode_cache)
+{
+    setUpAnalyzer(" LR 1,1\n LR 1,1\n LR 1,1\n LR 1,1");
+    const auto& metrics = a->get_metrics();
+    EXPECT_GT(metrics.opcode_cache_hits, 0);
+    EXPECT_GT(metrics.opcode_cache_misses, 0);
+    EXPECT_GT(metrics.opcode_cache_hit_rate(), 0.5);
+}
+
+TEST_F(benchmark_test, mach_evaluation_cache)
+{
+    setUpAnalyzer(R"(
+         MACRO
+         MAC
+         LA    1,X+Y*2
+         MEND
+X        EQU   1
+Y        EQU   2
+         MAC
+         MAC
+         MAC
+         MAC
+)");
+    const auto& metrics = a->get_metrics();
+    EXPECT_GT(metrics.mach_evaluation_cache_hits, 0);
+    EXPECT_GT(metrics.mach_evaluation_cache_misses, 0);
+    EXPECT_GT(metrics.mach_evaluation_cache_hit_rate(), 0.5);
+}
@@ -12,6 +12,7 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -19,6 +20,7 @@
 
 #include "analyzer.h"
 #include "utils/general_hashers.h"
+#include "workspaces/file.h"
 
 namespace hlasm_plugin::parser_library {
 
@@ -89,8 +91,9 @@ public:
     }
 
 
-    utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>> get_library(
-        std::string library) override
+    utils::value_task<
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, utils::resource::resource_location>>>
+    get_library(std::string library) override
     {
         auto it = m_files.find(library);
         if (it == m_files.end())
@@ -99,8 +102,8 @@ public:
         }
 
         ++it->second.stats.content_requests;
-        co_return std::pair<std::string, utils::resource::resource_location>(
-            it->second.content, utils::resource::resource_location(std::move(library)));
+        co_return std::make_pair(
+            workspaces::make_text_buffer(it->second.content), utils::resource::resource_location(std::move(library)));
     }
 
     std::optional<mock_file_stats_t> get_stats(std::string_view library) const
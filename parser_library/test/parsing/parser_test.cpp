@@ -12,6 +12,9 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <set>
+#include <string>
+
 #include "gtest/gtest.h"
 
 #include "../common_testing.h"
@@ -70,3 +73,39 @@ TEST_P(library_test, syntax_errors)
     // no errors found while parsing
     EXPECT_EQ(get_syntax_errors(*holder), size_t_zero);
 }
+
+TEST(parser, syntax_check_only_skips_processing)
+{
+    const std::string input = R"(
+ MACRO
+ MAC
+ MNOTE 8,'EXPANDED'
+ MEND
+ MAC
+ COPY MISSING
+ AIF ('&SYSPARM' EQ '').A('&SYSPARM' EQ '').A
+.L ANOP
+ AGO .L
+)";
+    const auto codes = [&input](syntax_check_only so) {
+        analyzer a(input, analyzer_options { file_is_opencode::yes, so });
+        a.analyze();
+        a.collect_diags();
+
+        std::set<std::string> result;
+        for (const auto& d : a.diags())
+            result.insert(d.code);
+        return result;
+    };
+
+    const auto full = codes(syntax_check_only::no);
+    EXPECT_TRUE(full.contains("MNOTE"));
+    EXPECT_TRUE(full.contains("E058"));
+    EXPECT_TRUE(full.contains("E056"));
+
+    const auto syntax = codes(syntax_check_only::yes);
+    EXPECT_TRUE(syntax.contains("S0002"));
+    EXPECT_FALSE(syntax.contains("MNOTE"));
+    EXPECT_FALSE(syntax.contains("E058"));
+    EXPECT_FALSE(syntax.contains("E056"));
+}
@@ -16,6 +16,7 @@
 
 #include "../common_testing.h"
 #include "../mock_parse_lib_provider.h"
+#include "processing/ainsert_buffer.h"
 
 using namespace hlasm_plugin::utils::resource;
 
@@ -515,3 +516,87 @@ TEST(ainsert, grammar_non_matching_apostrophes_by_one_02)
 
     EXPECT_TRUE(matches_message_codes(a.diags(), { "S0002", "S0005", "S0005", "A011" }));
 }
+
+TEST(ainsert, buffer_spans_chunks)
+{
+    using hlasm_plugin::parser_library::processing::ainsert_buffer;
+
+    ainsert_buffer buffer;
+    const std::string big(ainsert_buffer::chunk_size / 2 + 1, 'X');
+
+    buffer.push_back(big);
+    buffer.push_back("B");
+    buffer.push_back(big);
+    buffer.push_front("F");
+
+    EXPECT_EQ(buffer.size(), 4);
+    EXPECT_EQ(buffer.allocated_chunks(), 2);
+    EXPECT_EQ(buffer.joined_size(), 2 * big.size() + 2 + 4);
+
+    EXPECT_EQ(buffer.front(), "F");
+    buffer.pop_front();
+    EXPECT_EQ(buffer.front(), big);
+    buffer.pop_front();
+    EXPECT_EQ(buffer.front(), "B");
+    buffer.pop_front();
+    EXPECT_EQ(buffer.front(), big);
+    buffer.pop_front();
+
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.allocated_chunks(), 1);
+}
+
+TEST(ainsert, buffer_releases_popped_chunks)
+{
+    using hlasm_plugin::parser_library::processing::ainsert_buffer;
+
+    ainsert_buffer buffer;
+    const std::string rec(1000, 'X');
+
+    // the buffer never becomes empty
+    buffer.push_back("FIRST");
+    for (size_t i = 0; i < 100 * ainsert_buffer::chunk_size / rec.size(); ++i)
+    {
+        buffer.push_back(rec);
+        buffer.pop_front();
+        EXPECT_EQ(buffer.front(), rec);
+    }
+
+    EXPECT_EQ(buffer.size(), 1);
+    EXPECT_LE(buffer.allocated_chunks(), 3);
+}
+
+TEST(ainsert, many_records)
+{
+    std::string input = R"(
+    MACRO
+    GEN
+    GBLC &R1,&R2
+    LCLA &I,&J
+.L  ANOP
+&J  SETA &I+1
+    AINSERT '&&V(&J) SETA &I',BACK
+&I  SETA &J
+    AIF (&I LT 2000).L
+&R1 AREAD
+&R2 AREAD
+    MEND
+
+    GBLC &R1,&R2
+    GEN
+)";
+
+    analyzer a(input);
+    a.analyze();
+    a.collect_diags();
+
+    EXPECT_TRUE(a.diags().empty());
+
+    auto expected = [](std::string s) {
+        s.resize(80, ' ');
+        return s;
+    };
+    EXPECT_EQ(get_var_value<C_t>(a.hlasm_ctx(), "R1"), expected("&V(1) SETA 0"));
+    EXPECT_EQ(get_var_value<C_t>(a.hlasm_ctx(), "R2"), expected("&V(2) SETA 1"));
+    EXPECT_EQ(get_var_vector_map<A_t>(a.hlasm_ctx(), "V").value_or(std::unordered_map<size_t, A_t>()).size(), 1998);
+}
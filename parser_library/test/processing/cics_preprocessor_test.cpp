@@ -27,6 +27,7 @@
 #include "preprocessor_options.h"
 #include "processing/preprocessor.h"
 #include "semantics/source_info_processor.h"
+#include "workspaces/file.h"
 
 // test cics preprocessor emulator
 
@@ -38,8 +39,9 @@ std::pair<int, std::string> test_cics_miniparser(const std::vector<std::string_v
 } // namespace hlasm_plugin::parser_library::processing::test
 
 constexpr auto empty_library_fetcher =
-    [](std::string) -> hlasm_plugin::utils::value_task<
-                        std::optional<std::pair<std::string, hlasm_plugin::utils::resource::resource_location>>> {
+    [](std::string) -> hlasm_plugin::utils::value_task<std::optional<std::pair<
+                        std::shared_ptr<const workspaces::text_buffer>,
+                        hlasm_plugin::utils::resource::resource_location>>> {
     co_return std::nullopt;
 };
 
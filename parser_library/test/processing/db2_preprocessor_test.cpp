@@ -14,9 +14,11 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "../common_testing.h"
 #include "../mock_parse_lib_provider.h"
@@ -26,6 +28,7 @@
 #include "processing/preprocessor.h"
 #include "semantics/source_info_processor.h"
 #include "utils/resource_location.h"
+#include "workspaces/file.h"
 
 // test db2 preprocessor emulator
 
@@ -40,7 +43,7 @@ const mock_file_stats_t invalid_stats { (size_t)-1, (size_t)-1, (size_t)-1 };
 
 constexpr auto empty_library_fetcher =
     [](std::string) -> hlasm_plugin::utils::value_task<
-                        std::optional<std::pair<std::string, hlasm_plugin::utils::resource::resource_location>>> {
+                        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>> {
     co_return std::nullopt;
 };
 } // namespace
@@ -96,11 +99,10 @@ TEST_F(db2_preprocessor_test, include)
 {
     auto p = create_preprocessor(
         db2_preprocessor_options {},
-        [](std::string s) -> hlasm_plugin::utils::value_task<
-                              std::optional<std::pair<std::string, hlasm_plugin::utils::resource::resource_location>>> {
+        [](std::string s) -> hlasm_plugin::utils::value_task<std::optional<
+                              std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>> {
             EXPECT_EQ(s, "MEMBER");
-            co_return std::pair<std::string, hlasm_plugin::utils::resource::resource_location>(
-                "member content", hlasm_plugin::utils::resource::resource_location());
+            co_return std::make_pair(workspaces::make_text_buffer("member content"), resource_location());
         },
         nullptr);
     std::string_view text = "\n EXEC SQL INCLUDE MEMBER ";
@@ -120,8 +122,8 @@ struct library_fetcher_call_confirmer
 {
     bool called = false;
 
-    hlasm_plugin::utils::value_task<
-        std::optional<std::pair<std::string, hlasm_plugin::utils::resource::resource_location>>>
+    hlasm_plugin::utils::value_task<std::optional<
+        std::pair<std::shared_ptr<const workspaces::text_buffer>, hlasm_plugin::utils::resource::resource_location>>>
     operator()(std::string_view)
     {
         called = true;
@@ -229,11 +231,10 @@ TEST_F(db2_preprocessor_test, no_nested_include)
 {
     auto p = create_preprocessor(
         db2_preprocessor_options {},
-        [](std::string s) -> hlasm_plugin::utils::value_task<
-                              std::optional<std::pair<std::string, hlasm_plugin::utils::resource::resource_location>>> {
+        [](std::string s) -> hlasm_plugin::utils::value_task<std::optional<
+                              std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>> {
             EXPECT_EQ(s, "MEMBER");
-            co_return std::pair<std::string, hlasm_plugin::utils::resource::resource_location>(
-                " EXEC SQL INCLUDE MEMBER", hlasm_plugin::utils::resource::resource_location());
+            co_return std::make_pair(workspaces::make_text_buffer(" EXEC SQL INCLUDE MEMBER"), resource_location());
         },
         &m_diags);
     std::string_view text = " EXEC SQL INCLUDE MEMBER ";
@@ -244,6 +245,95 @@ TEST_F(db2_preprocessor_test, no_nested_include)
     EXPECT_TRUE(matches_message_codes(m_diags.diags, { "DB003" }));
 }
 
+TEST_F(db2_preprocessor_test, prefetch)
+{
+    std::vector<std::string> events;
+    using library_result =
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>;
+    const auto wait = [&events](std::string s) -> hlasm_plugin::utils::value_task<library_result> {
+        co_await hlasm_plugin::utils::task::suspend();
+        events.push_back("end " + s);
+        co_return std::make_pair(workspaces::make_text_buffer(s + " CONTENT"), resource_location());
+    };
+    auto p = create_preprocessor(
+        db2_preprocessor_options {},
+        [&events, &wait](std::string s) {
+            events.push_back("request " + s);
+            return wait(std::move(s));
+        },
+        &m_diags);
+    std::string_view text = R"( EXEC SQL INCLUDE AAA
+ EXEC SQL INCLUDE SQLCA
+ EXEC SQL INCLUDE BbB -- COMMENT
+ EXEC SQL INCLUDE                                                      X
+               CCC)";
+
+    auto result = p->generate_replacement(document(text)).run().value();
+
+    // the continued statement is not prefetched
+    EXPECT_EQ(events,
+        (std::vector<std::string> { "request AAA", "request BBB", "end AAA", "end BBB", "request CCC", "end CCC" }));
+    EXPECT_TRUE(m_diags.diags.empty());
+    EXPECT_EQ(std::count_if(result.begin(), result.end(), [](const auto& l) { return l.text().ends_with(" CONTENT"); }),
+        3);
+}
+
+TEST_F(db2_preprocessor_test, prefetch_nested_suspension)
+{
+    const auto load = [](std::string s) -> hlasm_plugin::utils::value_task<std::string> {
+        for (int i = 0; i < 3; ++i)
+            co_await hlasm_plugin::utils::task::suspend();
+        co_return s + " CONTENT";
+    };
+    auto p = create_preprocessor(
+        db2_preprocessor_options {},
+        [&load](std::string s) -> hlasm_plugin::utils::value_task<std::optional<
+                                   std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>> {
+            auto text = co_await load(std::move(s));
+            co_return std::make_pair(workspaces::make_text_buffer(std::move(text)), resource_location());
+        },
+        &m_diags);
+    std::string_view text = R"( EXEC SQL INCLUDE AAA
+ EXEC SQL INCLUDE BBB)";
+
+    auto result = p->generate_replacement(document(text)).run().value();
+
+    EXPECT_TRUE(m_diags.diags.empty());
+    EXPECT_EQ(std::count_if(result.begin(), result.end(), [](const auto& l) { return l.text().ends_with(" CONTENT"); }),
+        2);
+}
+
+TEST_F(db2_preprocessor_test, prefetch_requests_overlap)
+{
+    size_t outstanding = 0;
+    size_t max_outstanding = 0;
+    using library_result =
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>;
+    const auto wait = [&outstanding](std::string s) -> hlasm_plugin::utils::value_task<library_result> {
+        for (int i = 0; i < 3; ++i)
+            co_await hlasm_plugin::utils::task::suspend();
+        --outstanding;
+        co_return std::make_pair(workspaces::make_text_buffer(s + " CONTENT"), resource_location());
+    };
+    auto p = create_preprocessor(
+        db2_preprocessor_options {},
+        [&](std::string s) {
+            max_outstanding = std::max(max_outstanding, ++outstanding);
+            return wait(std::move(s));
+        },
+        &m_diags);
+    std::string_view text = R"( EXEC SQL INCLUDE AAA
+ EXEC SQL INCLUDE BBB)";
+
+    auto result = p->generate_replacement(document(text)).run().value();
+
+    EXPECT_EQ(max_outstanding, 2);
+    EXPECT_EQ(outstanding, 0);
+    EXPECT_TRUE(m_diags.diags.empty());
+    EXPECT_EQ(std::count_if(result.begin(), result.end(), [](const auto& l) { return l.text().ends_with(" CONTENT"); }),
+        2);
+}
+
 TEST(db2_preprocessor, sqlsect_available)
 {
     std::string input = R"(
@@ -386,3 +386,24 @@ H        DS    CL(L'H)
 
     EXPECT_TRUE(matches_message_codes(a.diags(), { "E033" }));
 }
+
+TEST(DC, macro_statement_reused)
+{
+    std::string input = R"(
+         MACRO
+         GEN
+         DC    X'0102,03',2XL2'1'
+         MEND
+S        DS    0C
+         GEN
+         GEN
+C        EQU   *-S
+)";
+
+    analyzer a(input);
+    a.analyze();
+    a.collect_diags();
+
+    EXPECT_TRUE(a.diags().empty());
+    EXPECT_EQ(get_symbol_abs(a.hlasm_ctx(), "C"), 14);
+}
@@ -12,11 +12,13 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "../common_testing.h"
 #include "../mock_parse_lib_provider.h"
@@ -27,6 +29,7 @@
 #include "processing/preprocessor.h"
 #include "semantics/source_info_processor.h"
 #include "utils/resource_location.h"
+#include "workspaces/file.h"
 
 using namespace hlasm_plugin::parser_library::processing;
 using namespace hlasm_plugin::utils::resource;
@@ -42,9 +45,12 @@ public:
     {
         return preprocessor::create(
             endevor_preprocessor_options(),
-            [libs](std::string s)
-                -> hlasm_plugin::utils::value_task<std::optional<std::pair<std::string, resource_location>>> {
-                co_return libs(s);
+            [libs](std::string s) -> hlasm_plugin::utils::value_task<std::optional<
+                                      std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>> {
+                std::optional<std::pair<std::string, resource_location>> member = libs(s);
+                if (!member)
+                    co_return std::nullopt;
+                co_return std::make_pair(workspaces::make_text_buffer(std::move(member->first)), member->second);
             },
             &m_diags,
             m_src_info);
@@ -145,6 +151,85 @@ TEST_F(endevor_preprocessor_test, nested)
     EXPECT_EQ(result.text(), "AAA\nBBB\nCCC\nDDD\nEEE\n");
 }
 
+TEST_F(endevor_preprocessor_test, prefetch)
+{
+    std::vector<std::string> events;
+    using library_result =
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>;
+    const auto wait = [&events](std::string s) -> hlasm_plugin::utils::value_task<library_result> {
+        co_await hlasm_plugin::utils::task::suspend();
+        events.push_back("end " + s);
+        co_return std::make_pair(workspaces::make_text_buffer(s + " CONTENT"), resource_location());
+    };
+    auto p = preprocessor::create(
+        endevor_preprocessor_options(),
+        [&events, &wait](std::string s) {
+            events.push_back("request " + s);
+            return wait(std::move(s));
+        },
+        &m_diags,
+        m_src_info);
+
+    auto result = p->generate_replacement(document("-INC AAA\n++INCLUDE BBB\n-INC AAA")).run().value();
+
+    EXPECT_EQ(events,
+        (std::vector<std::string> { "request AAA", "request BBB", "end AAA", "end BBB", "request AAA", "end AAA" }));
+    EXPECT_TRUE(m_diags.diags.empty());
+    EXPECT_EQ(result.text(), "AAA CONTENT\nBBB CONTENT\nAAA CONTENT\n");
+}
+
+TEST_F(endevor_preprocessor_test, prefetch_nested_suspension)
+{
+    const auto load = [](std::string s) -> hlasm_plugin::utils::value_task<std::string> {
+        for (int i = 0; i < 3; ++i)
+            co_await hlasm_plugin::utils::task::suspend();
+        co_return s + " CONTENT";
+    };
+    auto p = preprocessor::create(
+        endevor_preprocessor_options(),
+        [&load](std::string s) -> hlasm_plugin::utils::value_task<std::optional<
+                                   std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>> {
+            auto text = co_await load(std::move(s));
+            co_return std::make_pair(workspaces::make_text_buffer(std::move(text)), resource_location());
+        },
+        &m_diags,
+        m_src_info);
+
+    auto result = p->generate_replacement(document("-INC AAA\n++INCLUDE BBB\n-INC CCC")).run().value();
+
+    EXPECT_TRUE(m_diags.diags.empty());
+    EXPECT_EQ(result.text(), "AAA CONTENT\nBBB CONTENT\nCCC CONTENT\n");
+}
+
+TEST_F(endevor_preprocessor_test, prefetch_requests_overlap)
+{
+    size_t outstanding = 0;
+    size_t max_outstanding = 0;
+    using library_result =
+        std::optional<std::pair<std::shared_ptr<const workspaces::text_buffer>, resource_location>>;
+    const auto wait = [&outstanding](std::string s) -> hlasm_plugin::utils::value_task<library_result> {
+        for (int i = 0; i < 3; ++i)
+            co_await hlasm_plugin::utils::task::suspend();
+        --outstanding;
+        co_return std::make_pair(workspaces::make_text_buffer(s + " CONTENT"), resource_location());
+    };
+    auto p = preprocessor::create(
+        endevor_preprocessor_options(),
+        [&](std::string s) {
+            max_outstanding = std::max(max_outstanding, ++outstanding);
+            return wait(std::move(s));
+        },
+        &m_diags,
+        m_src_info);
+
+    auto result = p->generate_replacement(document("-INC AAA\n++INCLUDE BBB\n-INC CCC")).run().value();
+
+    EXPECT_EQ(max_outstanding, 3);
+    EXPECT_EQ(outstanding, 0);
+    EXPECT_TRUE(m_diags.diags.empty());
+    EXPECT_EQ(result.text(), "AAA CONTENT\nBBB CONTENT\nCCC CONTENT\n");
+}
+
 TEST(endevor_preprocessor, with_analyzer)
 {
     mock_parse_lib_provider libs({
@@ -1364,3 +1364,28 @@ Y        DS    C
     EXPECT_EQ(outhere1, location(position(5, 0), opencode));
     EXPECT_EQ(outhere2, location(position(9, 0), opencode));
 }
+
+TEST(lookahead, opencode_loop_over_continued_statements)
+{
+    std::string input = R"(
+START    DS    0C
+&I       SETA  0
+.LOOP    ANOP
+&I       SETA  &I+1
+         DC    C'A',                                                   X
+               C'B'
+&L       SETA  L'LATER
+         AIF   (&I LT 300).LOOP
+LEN      EQU   *-START
+LATER    DS    CL3
+)";
+
+    analyzer a(input);
+    a.analyze();
+    a.collect_diags();
+
+    EXPECT_TRUE(a.diags().empty());
+
+    EXPECT_EQ(get_symbol_abs(a.hlasm_ctx(), "LEN"), 600);
+    EXPECT_EQ(get_var_value<A_t>(a.hlasm_ctx(), "L"), 3);
+}
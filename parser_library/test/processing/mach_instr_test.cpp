@@ -12,6 +12,9 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <atomic>
+#include <numeric>
+
 #include "gtest/gtest.h"
 
 #include "../common_testing.h"
@@ -400,3 +403,56 @@ TEST(mach_instr_processing, check_combined_lookup)
         EXPECT_EQ(mn, &orig_mn);
     }
 }
+
+TEST(mach_instr_processing, postponed_checks_in_source_order)
+{
+    constexpr size_t count = 20;
+    std::string input = "\n";
+    for (size_t i = 0; i < count; ++i)
+        input.append("    LR  1,R").append(std::to_string(i)).append("\n");
+    for (size_t i = 0; i < count; ++i)
+        input.append("R").append(std::to_string(i)).append(" EQU ").append(std::to_string(16 + i)).append("\n");
+
+    analyzer a(input);
+    a.analyze();
+    a.collect_diags();
+
+    std::vector<size_t> lines;
+    for (const auto& d : a.diags())
+        lines.push_back(d.diag_range.start.line);
+
+    std::vector<size_t> expected(count);
+    std::iota(expected.begin(), expected.end(), (size_t)1);
+
+    EXPECT_EQ(lines, expected);
+}
+
+TEST(mach_instr_processing, postponed_checks_yield)
+{
+    constexpr size_t count = 50;
+    std::string instructions;
+    std::string equates;
+    for (size_t i = 0; i < count; ++i)
+    {
+        instructions.append("    LR  1,R").append(std::to_string(i)).append("\n");
+        equates.append("R").append(std::to_string(i)).append(" EQU ").append(std::to_string(i % 16)).append("\n");
+    }
+
+    const auto count_slices = [](std::string input) {
+        analyzer a(input);
+        std::atomic<unsigned char> yield_indicator = 1;
+        auto t = a.co_analyze();
+        size_t slices = 0;
+        while (!t.done())
+        {
+            t.resume(&yield_indicator);
+            ++slices;
+        }
+        return slices;
+    };
+
+    const auto without_postponed = count_slices(equates + instructions);
+    const auto with_postponed = count_slices(instructions + equates);
+
+    EXPECT_GE(with_postponed, without_postponed + count);
+}
@@ -90,6 +90,22 @@ LR OPSYN
     EXPECT_EQ(a.diags().size(), (size_t)1);
 }
 
+TEST(OPSYN, redefine_after_use)
+{
+    std::string input(R"(
+  LR 1,1
+LR OPSYN 
+  LR 1,1
+LR OPSYN AR
+  LR 1,1
+)");
+    analyzer a(input);
+    a.analyze();
+    a.collect_diags();
+    EXPECT_TRUE(matches_message_codes(a.diags(), { "E049" }));
+    EXPECT_GT(a.get_metrics().opcode_cache_misses, 2);
+}
+
 TEST(OPSYN, preserve_opcode)
 {
     std::string input(R"(
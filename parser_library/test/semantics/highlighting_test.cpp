@@ -22,6 +22,8 @@
 #include "../gtest_stringers.h"
 #include "../mock_parse_lib_provider.h"
 #include "analyzer.h"
+#include "lsp/file_info.h"
+#include "lsp/lsp_context.h"
 #include "preprocessor_options.h"
 #include "protocol.h"
 #include "semantics/highlighting_info.h"
@@ -725,3 +727,45 @@ TEST(highlighting, nested_preprocessors)
 
     EXPECT_EQ(tokens, expected);
 }
+
+TEST(highlighting, packed_round_trip)
+{
+    const semantics::lines_info tokens = {
+        token_info({ { 5, 0 }, { 5, 1 } }, hl_scopes::label),
+        token_info({ { 5, 2 }, { 7, 5 } }, hl_scopes::instruction),
+        token_info({ { 1, 6 }, { 1, 7 } }, hl_scopes::number),
+        token_info({ { 2, 0 }, { 2, 70000 } }, hl_scopes::remark),
+        token_info({ { 3, 0 }, { 300, 1 } }, hl_scopes::string),
+        token_info({ { position::max_value, 0 }, { position::max_value, 1 } }, hl_scopes::operand),
+        token_info({ { 0, 0 }, { 0, 1 } }, hl_scopes::ordinary_symbol),
+    };
+
+    const packed_lines_info packed(tokens);
+
+    EXPECT_EQ(packed.size(), tokens.size());
+    EXPECT_EQ(packed.unpack(), tokens);
+}
+
+TEST(highlighting, bytes_per_line)
+{
+    constexpr size_t lines = 1000;
+    std::string contents;
+    for (size_t i = 0; i < lines; ++i)
+        contents.append("L").append(std::to_string(i)).append(" LR 1,2\n");
+
+    analyzer a(contents, analyzer_options { source_file_loc, collect_highlighting_info::yes });
+    a.analyze();
+
+    const auto tokens = a.take_semantic_tokens();
+    const packed_lines_info packed(tokens);
+
+    EXPECT_EQ(packed.unpack(), tokens);
+    EXPECT_EQ(packed.memory_usage(), 12 * tokens.size());
+    EXPECT_LE(packed.memory_usage() / lines, 64);
+
+    const auto* fi = a.context().lsp_ctx->get_file_info(source_file_loc);
+    ASSERT_TRUE(fi);
+    const auto occurrence_bytes = fi->get_occurrences().size() * sizeof(lsp::symbol_occurrence)
+        + fi->get_line_details().size() * sizeof(lsp::line_occurence_details);
+    EXPECT_LE(occurrence_bytes / lines, 144);
+}
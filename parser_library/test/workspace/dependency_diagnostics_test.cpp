@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "gtest/gtest.h"
+
+#include "diagnostic.h"
+#include "utils/resource_location.h"
+#include "workspaces/dependency_diagnostics.h"
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+using hlasm_plugin::utils::resource::resource_location;
+
+namespace {
+const resource_location copy_loc("ws:/lib/COPY");
+
+diagnostic_s make_diag(std::string code, std::string program)
+{
+    diagnostic_s d(copy_loc.get_uri(), range(position(1, 0), position(1, 5)), code, "message");
+    d.related.emplace_back(range_uri_s(std::move(program), range()), "While compiling");
+    return d;
+}
+} // namespace
+
+TEST(dependency_diagnostics, identical_sets_are_shared)
+{
+    dependency_diagnostics_store store;
+
+    auto a = store.intern(copy_loc, 1, { make_diag("W1", "ws:/A") });
+    auto b = store.intern(copy_loc, 1, { make_diag("W1", "ws:/B") });
+
+    EXPECT_EQ(a.set, b.set);
+    EXPECT_EQ(store.size(), 1);
+    EXPECT_TRUE(a.set->diags.front().related.empty());
+}
+
+TEST(dependency_diagnostics, different_sets)
+{
+    dependency_diagnostics_store store;
+
+    auto a = store.intern(copy_loc, 1, { make_diag("W1", "ws:/A") });
+    auto b = store.intern(copy_loc, 1, { make_diag("W2", "ws:/A") });
+    auto c = store.intern(copy_loc, 2, { make_diag("W1", "ws:/A") });
+
+    EXPECT_NE(a.set, b.set);
+    EXPECT_NE(a.set, c.set);
+    EXPECT_EQ(store.size(), 3);
+
+    b.set.reset();
+    c.set.reset();
+    EXPECT_EQ(store.size(), 1);
+}
+
+TEST(dependency_diagnostics, merge)
+{
+    dependency_diagnostics_store store;
+
+    const auto a = store.intern(copy_loc, 1, { make_diag("W1", "ws:/A"), make_diag("W2", "ws:/A") });
+    const auto b = store.intern(copy_loc, 1, { make_diag("W1", "ws:/B") });
+    const auto c = store.intern(copy_loc, 1, { make_diag("W2", "ws:/C"), make_diag("W1", "ws:/C") });
+    const dependency_diagnostics_use* uses[] = { &a, &b, &c };
+
+    std::vector<diagnostic_s> result;
+    merge_dependency_diagnostics(result, uses);
+
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].code, "W1");
+    EXPECT_EQ(result[1].code, "W2");
+}
+
+TEST(dependency_diagnostics, merge_keeps_stacks_of_each_program)
+{
+    dependency_diagnostics_store store;
+
+    const auto a = store.intern(copy_loc, 1, { make_diag("W1", "ws:/A") });
+    const auto b = store.intern(copy_loc, 1, { make_diag("W1", "ws:/B") });
+    ASSERT_EQ(a.set, b.set);
+
+    const auto programs = [](const diagnostic_s& d) {
+        std::vector<std::string> result;
+        for (const auto& r : d.related)
+            result.push_back(r.location.uri);
+        return result;
+    };
+
+    std::vector<diagnostic_s> both;
+    const dependency_diagnostics_use* both_uses[] = { &a, &b };
+    merge_dependency_diagnostics(both, both_uses);
+    ASSERT_EQ(both.size(), 1);
+    EXPECT_EQ(programs(both[0]), (std::vector<std::string> { "ws:/A", "ws:/B" }));
+
+    // the first program is closed, its stack must not be reported anymore
+    std::vector<diagnostic_s> only_b;
+    const dependency_diagnostics_use* b_uses[] = { &b };
+    merge_dependency_diagnostics(only_b, b_uses);
+    ASSERT_EQ(only_b.size(), 1);
+    EXPECT_EQ(programs(only_b[0]), (std::vector<std::string> { "ws:/B" }));
+}
+
+TEST(dependency_diagnostics, merge_keeps_related_of_each_diagnostic)
+{
+    dependency_diagnostics_store store;
+
+    auto nested = make_diag("W2", "ws:/MAC");
+    nested.related.emplace_back(range_uri_s("ws:/A", range()), "While compiling");
+
+    const auto a = store.intern(
+        copy_loc, 1, { diagnostic_s(copy_loc.get_uri(), range(), "W0", "message"), nested, make_diag("W3", "ws:/A") });
+    const dependency_diagnostics_use* uses[] = { &a };
+
+    std::vector<diagnostic_s> result;
+    merge_dependency_diagnostics(result, uses);
+
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_TRUE(result[0].related.empty());
+    ASSERT_EQ(result[1].related.size(), 2);
+    EXPECT_EQ(result[1].related[0].location.uri, "ws:/MAC");
+    EXPECT_EQ(result[1].related[1].location.uri, "ws:/A");
+    ASSERT_EQ(result[2].related.size(), 1);
+    EXPECT_EQ(result[2].related[0].location.uri, "ws:/A");
+}
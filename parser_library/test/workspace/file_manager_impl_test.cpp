@@ -94,6 +94,34 @@ TEST(file_manger, keep_content_on_close)
     EXPECT_EQ(f1->get_version(), f2->get_version());
 }
 
+TEST(file_manager, shared_text_buffer)
+{
+    const resource_location file("filename");
+
+    NiceMock<external_file_reader_mock> reader_mock;
+    file_manager_impl fm(reader_mock);
+
+    fm.did_open_file(file, 1, "A\nB");
+
+    auto buffer = fm.add_file(file).run().value()->get_text_buffer();
+
+    EXPECT_EQ(buffer->text, "A\nB");
+    EXPECT_EQ(buffer->line_indices, (std::vector<size_t> { 0, 2 }));
+    EXPECT_EQ(buffer->text.data(), fm.find(file)->get_text().data());
+
+    const std::string new_text = "C\nD\nE";
+    const hlasm_plugin::parser_library::document_change change(new_text.c_str(), new_text.size());
+    fm.did_change_file(file, 2, &change, 1);
+
+    // the shared buffer must not be modified in place
+    EXPECT_EQ(buffer->text, "A\nB");
+    EXPECT_EQ(buffer->line_indices, (std::vector<size_t> { 0, 2 }));
+
+    auto new_buffer = fm.find(file)->get_text_buffer();
+    EXPECT_EQ(new_buffer->text, new_text);
+    EXPECT_EQ(new_buffer->line_indices, (std::vector<size_t> { 0, 2, 4 }));
+}
+
 TEST(file_manager, get_file_content)
 {
     if (hlasm_plugin::utils::platform::is_web())
@@ -66,7 +66,7 @@ public:
         (unsigned long long id, std::string_view text, resource_location related_workspace),
         (override));
     MOCK_METHOD(void, remove_virtual_file, (unsigned long long id), (override));
-    MOCK_METHOD(std::string, get_virtual_file, (unsigned long long id), (const, override));
+    MOCK_METHOD(std::shared_ptr<const std::string>, get_virtual_file, (unsigned long long id), (const, override));
     MOCK_METHOD(resource_location, get_virtual_file_workspace, (unsigned long long id), (const, override));
 
     MOCK_METHOD(value_task<hlasm_plugin::parser_library::workspaces::file_content_state>,
@@ -401,3 +401,90 @@ TEST(macro_cache_test, inline_depends_on_copy)
     file_mngr.did_change_file(copy_file_loc, 0, &simple_change, 1);
     EXPECT_FALSE(copy_c.load_from_cache(copy_key, new_ctx_2));
 }
+
+TEST(macro_cache_test, unchanged_statements_reused)
+{
+    std::string opencode_file_name = "opencode";
+    std::string macro_file_name = "lib/MAC";
+    resource_location macro_file_loc(macro_file_name);
+    std::string macro_text =
+        R"( MACRO
+       MAC &PARAM
+       LCLA &A
+&A     SETA 1
+       MNOTE 'A'
+       MEND
+)";
+
+    file_manager_impl file_mngr;
+    auto macro_file = open_file(macro_file_loc, macro_text, file_mngr);
+    macro_cache macro_c(file_mngr, macro_file);
+    constexpr context::id_index macro_id("MAC");
+    macro_cache_key macro_key { { processing::processing_kind::MACRO, macro_id }, {} };
+
+    auto ids = std::make_shared<context::id_storage>();
+
+    save_dependency(macro_c,
+        parse_dependency(
+            macro_file, create_analyzing_context(opencode_file_name, ids), processing::processing_kind::MACRO));
+
+    analyzing_context old_ctx = create_analyzing_context(opencode_file_name, ids);
+    ASSERT_TRUE(macro_c.load_from_cache(macro_key, old_ctx));
+    auto old_def = old_ctx.hlasm_ctx->get_macro_definition(macro_id);
+    ASSERT_TRUE(old_def);
+
+    // change the operand of MNOTE
+    document_change change(range({ 4, 14 }, { 4, 15 }), "B", 1);
+    file_mngr.did_change_file(macro_file_loc, 1, &change, 1);
+    auto changed_file = file_mngr.find(macro_file_loc);
+    ASSERT_NE(changed_file, macro_file);
+
+    macro_cache changed_c(file_mngr, changed_file);
+    changed_c.inherit_statements_from(macro_c);
+    save_dependency(changed_c,
+        parse_dependency(
+            changed_file, create_analyzing_context(opencode_file_name, ids), processing::processing_kind::MACRO));
+
+    analyzing_context new_ctx = create_analyzing_context(opencode_file_name, ids);
+    ASSERT_TRUE(changed_c.load_from_cache(macro_key, new_ctx));
+    auto new_def = new_ctx.hlasm_ctx->get_macro_definition(macro_id);
+    ASSERT_TRUE(new_def);
+    ASSERT_EQ(new_def->cached_definition.size(), old_def->cached_definition.size());
+
+    for (size_t i = 0; i < new_def->cached_definition.size(); ++i)
+    {
+        const auto& base = new_def->cached_definition[i].get_base();
+        const bool reused = base == old_def->cached_definition[i].get_base();
+        EXPECT_EQ(reused, base->statement_position().line != 4) << i;
+    }
+}
+
+TEST(macro_cache_test, inherited_statements_released_by_next_save)
+{
+    std::string opencode_file_name = "opencode";
+    resource_location macro_file_loc("lib/MAC");
+
+    file_manager_impl file_mngr;
+    auto macro_file = open_file(macro_file_loc, " MACRO\n MAC\n MEND\n", file_mngr);
+    macro_cache macro_c(file_mngr, macro_file);
+
+    auto ids = std::make_shared<context::id_storage>();
+
+    save_dependency(macro_c,
+        parse_dependency(
+            macro_file, create_analyzing_context(opencode_file_name, ids), processing::processing_kind::MACRO));
+
+    document_change change(range({ 1, 0 }, { 1, 0 }), "*", 1);
+    file_mngr.did_change_file(macro_file_loc, 1, &change, 1);
+    auto changed_file = file_mngr.find(macro_file_loc);
+
+    macro_cache changed_c(file_mngr, changed_file);
+    changed_c.inherit_statements_from(macro_c);
+    EXPECT_TRUE(changed_c.has_inherited_statements());
+
+    // the file is now used as a copy member, the key does not match the inherited macro
+    save_dependency(changed_c,
+        parse_dependency(
+            changed_file, create_analyzing_context(opencode_file_name, ids), processing::processing_kind::COPY));
+    EXPECT_FALSE(changed_c.has_inherited_statements());
+}
@@ -57,9 +57,10 @@ TEST(processor_file, parse_macro)
 
     run_if_valid(ws.did_open_file(opencode_loc, file_content_state::changed_content));
 
-    auto [url, wf_info, metrics, errors, warnings] = ws.parse_file().run().value();
+    auto [url, wf_info, metrics, errors, warnings, preliminary] = ws.parse_file().run().value();
     EXPECT_EQ(url, opencode_loc);
     EXPECT_TRUE(metrics);
+    EXPECT_FALSE(preliminary);
 
     // Opencode file tests
 
@@ -85,6 +86,11 @@ TEST(processor_file, parse_macro)
     expected_metrics.macro_statements = 2;
     expected_metrics.non_continued_statements = 6;
     expected_metrics.open_code_statements = 2;
+    // the cache statistics are checked in metrics_test
+    expected_metrics.opcode_cache_hits = metrics->opcode_cache_hits;
+    expected_metrics.opcode_cache_misses = metrics->opcode_cache_misses;
+    expected_metrics.mach_evaluation_cache_hits = metrics->mach_evaluation_cache_hits;
+    expected_metrics.mach_evaluation_cache_misses = metrics->mach_evaluation_cache_misses;
     EXPECT_EQ(metrics, expected_metrics);
     EXPECT_EQ(ws.last_metrics(opencode_loc), expected_metrics);
     EXPECT_EQ(wf_info.files_processed, 2);
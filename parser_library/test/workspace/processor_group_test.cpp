@@ -294,3 +294,47 @@ TEST(processor_group, refresh_needed)
     // not used
     EXPECT_FALSE(should_be_refreshed(grp, resource_location("test://workspace/externals/library4")));
 }
+
+TEST(processor_group, member_index)
+{
+    const auto make_library = [](std::vector<std::string> files, const resource_location& lib_loc) {
+        auto lib = std::make_shared<StrictMock<library_mock>>();
+        EXPECT_CALL(*lib, get_location).WillRepeatedly(ReturnRef(lib_loc));
+        EXPECT_CALL(*lib, has_file)
+            .WillRepeatedly([files, &lib_loc](std::string_view file, resource_location* url) {
+                bool result = std::ranges::find(files, file) != files.end();
+                if (result && url)
+                    *url = resource_location::join(lib_loc, file);
+                return result;
+            });
+        return lib;
+    };
+
+    const resource_location lib1_loc("test://lib1/");
+    const resource_location lib2_loc("test://lib2/");
+    auto lib1 = make_library({ "MAC1" }, lib1_loc);
+    auto lib2 = make_library({ "MAC1", "MAC2" }, lib2_loc);
+
+    processor_group grp("", {}, {});
+    grp.add_library(lib1);
+    grp.add_library(lib2);
+
+    auto index = grp.member_index();
+    EXPECT_EQ(index, grp.member_index());
+
+    EXPECT_EQ(index->find("MAC1"), resource_location::join(lib1_loc, "MAC1"));
+    EXPECT_EQ(index->find("MAC2"), resource_location::join(lib2_loc, "MAC2"));
+    EXPECT_TRUE(index->find("LR").empty());
+
+    // repeated lookups, including the misses, are answered from the index
+    Mock::VerifyAndClearExpectations(lib1.get());
+    Mock::VerifyAndClearExpectations(lib2.get());
+    EXPECT_CALL(*lib1, has_file).Times(0);
+    EXPECT_CALL(*lib2, has_file).Times(0);
+
+    EXPECT_EQ(index->find("MAC1"), resource_location::join(lib1_loc, "MAC1"));
+    EXPECT_TRUE(index->find("LR").empty());
+
+    grp.invalidate_library_caches();
+    EXPECT_NE(index, grp.member_index());
+}
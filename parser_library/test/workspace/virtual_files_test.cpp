@@ -80,21 +80,25 @@ TEST(virtual_files, file_manager)
     const hlasm_plugin::utils::resource::resource_location related_workspace("workspace");
     file_manager_impl fm;
 
-    EXPECT_EQ(fm.get_virtual_file(0), empty);
+    EXPECT_EQ(fm.get_virtual_file(0), nullptr);
 
     fm.remove_virtual_file(0);
 
-    EXPECT_EQ(fm.get_virtual_file(0), empty);
+    EXPECT_EQ(fm.get_virtual_file(0), nullptr);
 
     auto stored_text = fm.put_virtual_file(0, content, related_workspace);
 
     EXPECT_EQ(stored_text, content);
-    EXPECT_EQ(fm.get_virtual_file(0), content);
+    auto file = fm.get_virtual_file(0);
+    ASSERT_TRUE(file);
+    EXPECT_EQ(*file, content);
+    EXPECT_EQ(file->data(), stored_text.data());
     EXPECT_EQ(fm.get_virtual_file_workspace(0), related_workspace);
 
     fm.remove_virtual_file(0);
 
-    EXPECT_EQ(fm.get_virtual_file(0), empty);
+    EXPECT_EQ(fm.get_virtual_file(0), nullptr);
+    EXPECT_EQ(*file, content);
     EXPECT_EQ(fm.get_virtual_file_workspace(0).get_uri(), empty);
 }
 TEST(virtual_files, callback_test_ainsert_valid_vfm)
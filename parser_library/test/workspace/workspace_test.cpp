@@ -739,3 +739,149 @@ TEST_F(workspace_test, track_nested_dependencies)
     EXPECT_EQ(collect_and_get_diags_size(ws), (size_t)1);
     EXPECT_TRUE(matches_message_codes(diags(), { "MNOTE" })); // SUP should not appear
 }
+
+TEST_F(workspace_test, shared_dependency_diagnostics)
+{
+    file_manager_extended file_manager;
+    file_manager.did_open_file(source3_loc, 2, source_using_macro_with_dep);
+    workspace ws(ws_loc, file_manager, config, global_settings);
+
+    ws.open().run();
+    run_if_valid(ws.did_open_file(source3_loc));
+    run_if_valid(ws.did_open_file(source4_loc));
+    parse_all_files(ws);
+
+    // both programs report the MNOTE located in the copy member
+    EXPECT_EQ(collect_and_get_diags_size(ws), (size_t)1);
+    EXPECT_TRUE(matches_message_codes(diags(), { "MNOTE" }));
+    EXPECT_TRUE(match_strings({ dep_macro_loc }));
+
+    const auto reported_by = [this](const resource_location& program) {
+        return std::ranges::any_of(
+            diags().front().related, [&program](const auto& r) { return r.location.uri == program.get_uri(); });
+    };
+    EXPECT_TRUE(reported_by(source3_loc));
+    EXPECT_TRUE(reported_by(source4_loc));
+
+    run_if_valid(ws.did_close_file(source4_loc));
+    parse_all_files(ws);
+    EXPECT_EQ(collect_and_get_diags_size(ws), (size_t)1);
+    // the stack of the closed program is no longer reported
+    EXPECT_TRUE(reported_by(source3_loc));
+    EXPECT_FALSE(reported_by(source4_loc));
+}
+
+TEST_F(workspace_test, fast_syntax_diagnostics)
+{
+    const resource_location file_loc("fast_syntax");
+    file_manager_impl fm;
+    fm.did_open_file(file_loc, 0, R"(
+ UNKNOWN
+ AIF ('&SYSPARM' EQ '').A('&SYSPARM' EQ '').A
+.A ANOP
+)");
+
+    config.fast_syntax_diagnostics = true;
+    workspace ws(fm, config, global_settings);
+    ws.open().run();
+    run_if_valid(ws.did_open_file(file_loc));
+
+    auto first = ws.parse_file().run().value();
+    EXPECT_TRUE(first.preliminary);
+    EXPECT_EQ(collect_and_get_diags_size(ws), 1U);
+    EXPECT_TRUE(matches_message_codes(diags(), { "S0002" }));
+
+    auto second = ws.parse_file().run().value();
+    EXPECT_FALSE(second.preliminary);
+    collect_and_get_diags_size(ws);
+    EXPECT_TRUE(matches_message_codes(diags(), { "E049", "S0002" }));
+
+    EXPECT_FALSE(ws.parse_file().valid());
+}
+
+TEST_F(workspace_test, fast_syntax_diagnostics_skipped_with_preprocessor)
+{
+    file_manager_impl fm;
+    fm.did_open_file(proc_grps_loc, 1, R"({"pgroups":[{"name":"P1","libs":[],"preprocessor":"DB2"}]})");
+    fm.did_open_file(pgm_conf_loc, 1, R"({"pgms":[{"program":"source1","pgroup":"P1"}]})");
+    fm.did_open_file(source1_loc, 1, R"(
+         EXEC SQL INCLUDE SQLCA
+)");
+
+    config.fast_syntax_diagnostics = true;
+    workspace ws(ws_loc, fm, config, global_settings);
+    ws.open().run();
+    run_if_valid(ws.did_open_file(source1_loc));
+
+    auto first = ws.parse_file().run().value();
+    EXPECT_FALSE(first.preliminary);
+    EXPECT_EQ(collect_and_get_diags_size(ws), 0U);
+
+    EXPECT_FALSE(ws.parse_file().valid());
+}
+
+TEST_F(workspace_test, unexecuted_dependency_change_deferred)
+{
+    file_manager_extended file_manager;
+    file_manager.did_open_file(correct_macro_loc, 2, R"( MACRO
+ CORRECT
+ AIF (1).SKIP
+ MNOTE 'NEVER'
+.SKIP ANOP
+ MEND
+)");
+    workspace ws(ws_loc, file_manager, config, global_settings);
+
+    ws.open().run();
+    run_if_valid(ws.did_open_file(source3_loc));
+    run_if_valid(ws.did_open_file(source1_loc));
+    parse_all_files(ws);
+
+    // the MNOTE is skipped by the only expansion of the macro
+    document_change c(range(position(3, 8), position(3, 13)), "OTHER", 5);
+    file_manager.did_change_file(correct_macro_loc, 3, &c, 1);
+    run_if_valid(ws.did_change_file(correct_macro_loc, file_content_state::changed_content));
+    run_if_valid(ws.did_change_file(source1_loc, file_content_state::changed_content));
+
+    auto first = ws.parse_file();
+    ASSERT_TRUE(first.valid());
+    EXPECT_EQ(first.run().value().filename, source1_loc);
+
+    auto second = ws.parse_file();
+    ASSERT_TRUE(second.valid());
+    EXPECT_EQ(second.run().value().filename, source3_loc);
+
+    EXPECT_FALSE(ws.parse_file().valid());
+}
+
+TEST_F(workspace_test, structural_dependency_change_not_deferred)
+{
+    const auto deferred_after = [this](range r, std::string_view text) {
+        file_manager_extended file_manager;
+        file_manager.did_open_file(correct_macro_loc, 2, R"( MACRO
+ CORRECT
+ AIF (1).SKIP
+ MNOTE 'NEVER'
+.SKIP ANOP
+ MEND
+)");
+        workspace ws(ws_loc, file_manager, config, global_settings);
+
+        ws.open().run();
+        run_if_valid(ws.did_open_file(source3_loc));
+        parse_all_files(ws);
+
+        document_change c(r, text.data(), text.size());
+        file_manager.did_change_file(correct_macro_loc, 3, &c, 1);
+        run_if_valid(ws.did_change_file(correct_macro_loc, file_content_state::changed_content));
+
+        return ws.is_parsing_deferred(source3_loc);
+    };
+
+    EXPECT_TRUE(deferred_after(range(position(3, 8), position(3, 13)), "OTHER"));
+    // the unexecuted line becomes MEND or MACRO in the new version
+    EXPECT_FALSE(deferred_after(range(position(3, 1), position(3, 14)), "MEND"));
+    EXPECT_FALSE(deferred_after(range(position(3, 1), position(3, 14)), "MACRO"));
+    // continuation mark in column 72 joins the following line
+    EXPECT_FALSE(deferred_after(range(position(3, 14), position(3, 14)), std::string(57, ' ') + "X"));
+}
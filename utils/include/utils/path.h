@@ -17,7 +17,9 @@
 
 #include <filesystem>
 #include <functional>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include "list_directory_rc.h"
 
@@ -38,10 +40,15 @@ std::filesystem::path canonical(const std::filesystem::path& p, std::error_code&
 bool equal(const std::filesystem::path& left, const std::filesystem::path& right);
 bool is_directory(const std::filesystem::path& p);
 
-list_directory_rc list_directory_regular_files(
-    const std::filesystem::path& d, std::function<void(const std::filesystem::path&)> h);
+// The handlers receive names of the directory entries in batches, the names are valid only during the call
+using regular_files_handler = std::function<void(std::span<const std::string_view> files)>;
+// Symbolic links are reported separately and are not resolved
+using subdirs_and_symlinks_handler =
+    std::function<void(std::span<const std::string_view> subdirs, std::span<const std::string_view> symlinks)>;
+
+list_directory_rc list_directory_regular_files(const std::filesystem::path& d, const regular_files_handler& h);
 list_directory_rc list_directory_subdirs_and_symlinks(
-    const std::filesystem::path& d, std::function<void(const std::filesystem::path&)> h);
+    const std::filesystem::path& d, const subdirs_and_symlinks_handler& h);
 } // namespace hlasm_plugin::utils::path
 
 #endif
@@ -13,6 +13,9 @@
  */
 #include <algorithm>
 #include <emscripten.h>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <emscripten/bind.h>
 
@@ -382,21 +385,39 @@ std::filesystem::path current_path()
     return result;
 }
 
-list_directory_rc list_directory_regular_files(
-    const std::filesystem::path& d, std::function<void(const std::filesystem::path&)> h)
+list_directory_rc list_directory_regular_files(const std::filesystem::path& d, const regular_files_handler& h)
 {
+    std::vector<std::string> names;
     // directory listing seems broken everywhere
-    directory_op_support l(h);
-    return l.files(d);
+    directory_op_support l([&names](const std::filesystem::path& p) { names.emplace_back(filename(p).string()); });
+    auto rc = l.files(d);
+
+    if (!names.empty())
+    {
+        std::vector<std::string_view> views(names.begin(), names.end());
+        h(views);
+    }
+
+    return rc;
 }
 
 
 list_directory_rc list_directory_subdirs_and_symlinks(
-    const std::filesystem::path& d, std::function<void(const std::filesystem::path&)> h)
+    const std::filesystem::path& d, const subdirs_and_symlinks_handler& h)
 {
+    std::vector<std::string> names;
     // directory listing seems broken everywhere
-    directory_op_support l(h);
-    return l.subdirs_and_symlinks(d);
+    directory_op_support l([&names](const std::filesystem::path& p) { names.emplace_back(filename(p).string()); });
+    auto rc = l.subdirs_and_symlinks(d);
+
+    // directories and links are not distinguished, all of them are reported as links to be resolved
+    if (!names.empty())
+    {
+        std::vector<std::string_view> views(names.begin(), names.end());
+        h({}, views);
+    }
+
+    return rc;
 }
 
 std::filesystem::path canonical(const std::filesystem::path& p)
@@ -14,6 +14,10 @@
 
 #include "utils/filesystem_content_loader.h"
 
+#include <span>
+#include <string_view>
+
+#include "utils/encoding.h"
 #include "utils/path.h"
 #include "utils/path_conversions.h"
 #include "utils/platform.h"
@@ -26,16 +30,49 @@ std::optional<std::string> filesystem_content_loader::load_text(const resource_l
     return platform::read_file(resource.get_path());
 }
 
+namespace {
+// percent encoding works character by character, so URIs of the directory entries share the encoded directory prefix
+std::string directory_uri_prefix(const std::filesystem::path& dir)
+{
+    auto uri = utils::path::path_to_uri(utils::path::absolute(dir).string());
+    if (!uri.ends_with('/'))
+        uri.push_back('/');
+    return uri;
+}
+
+// only the Linux listing reports every link separately, elsewhere e.g. Windows junctions are listed as subdirectories
+#ifdef __linux__
+constexpr bool subdirs_exclude_links = true;
+#else
+constexpr bool subdirs_exclude_links = false;
+#endif
+
+void add_directory(list_directory_result& result, std::string canonical_path)
+{
+    auto found_dir = utils::resource::resource_location(utils::path::path_to_uri(canonical_path));
+    found_dir.join(""); // Ensure that this is a directory
+    result.first.emplace_back(std::move(canonical_path), std::move(found_dir));
+}
+} // namespace
+
 list_directory_result filesystem_content_loader::list_directory_files(
     const utils::resource::resource_location& directory_loc) const
 {
     std::filesystem::path path(directory_loc.get_path());
     list_directory_result result;
 
-    result.second = utils::path::list_directory_regular_files(path, [&result](const std::filesystem::path& f) {
-        result.first.emplace_back(utils::path::filename(f).string(),
-            utils::resource::resource_location(utils::path::path_to_uri(utils::path::absolute(f).string())));
-    });
+    const auto prefix = directory_uri_prefix(path);
+    result.second =
+        utils::path::list_directory_regular_files(path, [&result, &prefix](std::span<const std::string_view> files) {
+            result.first.reserve(result.first.size() + files.size());
+            for (auto name : files)
+            {
+                std::string uri;
+                uri.reserve(prefix.size() + name.size());
+                uri.append(prefix).append(utils::encoding::percent_encode(name));
+                result.first.emplace_back(name, utils::resource::resource_location(std::move(uri)));
+            }
+        });
 
     return result;
 }
@@ -46,18 +83,31 @@ list_directory_result filesystem_content_loader::list_directory_subdirs_and_syml
     std::filesystem::path path(directory_loc.get_path());
     list_directory_result result;
 
-    result.second = utils::path::list_directory_subdirs_and_symlinks(path, [&result](const std::filesystem::path& p) {
+    std::error_code dir_ec;
+    const auto canonical_dir = utils::path::canonical(path, dir_ec);
+
+    const auto add_resolved = [&result](const std::filesystem::path& p) {
         std::error_code ec;
         auto cp = utils::path::canonical(p, ec);
 
         if (!ec && utils::path::is_directory(cp))
-        {
-            auto cp_str = cp.string();
-            auto found_dir = utils::resource::resource_location(utils::path::path_to_uri(cp_str));
-            found_dir.join(""); // Ensure that this is a directory
-            result.first.emplace_back(std::move(cp_str), std::move(found_dir));
-        }
-    });
+            add_directory(result, cp.string());
+    };
+
+    result.second = utils::path::list_directory_subdirs_and_symlinks(path,
+        [&result, &path, &canonical_dir, &dir_ec, &add_resolved](
+            std::span<const std::string_view> subdirs, std::span<const std::string_view> symlinks) {
+            for (auto name : subdirs)
+            {
+                // subdirectory of a canonical directory is canonical as well, unless it is a link
+                if (subdirs_exclude_links && !dir_ec)
+                    add_directory(result, utils::path::join(canonical_dir, name).string());
+                else
+                    add_resolved(utils::path::join(path, name));
+            }
+            for (auto name : symlinks)
+                add_resolved(utils::path::join(path, name));
+        });
 
     return result;
 }
@@ -12,7 +12,25 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 #include "utils/path.h"
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "utils/platform.h"
+#include "utils/scope_exit.h"
+
+#ifdef __linux__
+#    include <cerrno>
+
+#    include <dirent.h>
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
 
 namespace hlasm_plugin::utils::path {
 
@@ -53,39 +71,81 @@ bool is_directory(const std::filesystem::path& p)
     return !ec && d.is_directory();
 }
 
-list_directory_rc list_directory_regular_files(
-    const std::filesystem::path& d, std::function<void(const std::filesystem::path&)> h)
+namespace {
+#ifdef __linux__
+// Reads the directory using getdents64 directly, so that the entry types are obtained without stat calls.
+// Entries are passed to the handler in batches, one batch for every filled buffer.
+template<typename F>
+list_directory_rc read_directory(const std::filesystem::path& d, F&& process_batch)
 {
-    try
+    const int fd = ::open(d.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
     {
-        std::filesystem::directory_entry dir(d);
-
-        if (!dir.exists())
-            return list_directory_rc::not_exists;
+        switch (errno)
+        {
+            case ENOENT:
+                return list_directory_rc::not_exists;
+            case ENOTDIR:
+                if (struct stat st; ::stat(d.c_str(), &st) != 0)
+                    return list_directory_rc::not_exists;
+                return list_directory_rc::not_a_directory;
+            default:
+                return list_directory_rc::other_failure;
+        }
+    }
+    scope_exit close_fd([fd]() noexcept { ::close(fd); });
 
-        if (!dir.is_directory())
-            return list_directory_rc::not_a_directory;
+    // layout of linux_dirent64: ino (8), off (8), reclen (2), type (1), null terminated name
+    constexpr size_t reclen_offset = 16;
+    constexpr size_t type_offset = 18;
+    constexpr size_t name_offset = 19;
 
-        std::filesystem::directory_iterator it(dir);
+    alignas(8) std::array<char, 32 * 1024> buffer;
+    std::vector<std::pair<std::string_view, unsigned char>> entries;
+    for (;;)
+    {
+        const auto read = ::syscall(SYS_getdents64, fd, buffer.data(), buffer.size());
+        if (read < 0 && errno == EINTR)
+            continue;
+        if (read < 0)
+            return list_directory_rc::other_failure;
+        if (read == 0)
+            break;
 
-        for (auto& p : it)
+        entries.clear();
+        for (size_t pos = 0; pos < static_cast<size_t>(read);)
         {
-            if (p.is_regular_file())
-            {
-                h(p.path());
-            }
+            unsigned short reclen;
+            std::memcpy(&reclen, buffer.data() + pos + reclen_offset, sizeof(reclen));
+            const auto type = static_cast<unsigned char>(buffer[pos + type_offset]);
+            std::string_view name(buffer.data() + pos + name_offset);
+            pos += reclen;
+
+            if (name == "." || name == "..")
+                continue;
+            entries.emplace_back(name, type);
         }
-    }
-    catch (const std::filesystem::filesystem_error&)
-    {
-        return list_directory_rc::other_failure;
+        process_batch(fd, std::as_const(entries));
     }
 
     return list_directory_rc::done;
 }
 
-list_directory_rc list_directory_subdirs_and_symlinks(
-    const std::filesystem::path& d, std::function<void(const std::filesystem::path&)> h)
+bool stat_at(int dir_fd, std::string_view name, bool follow_symlinks, mode_t& mode)
+{
+    struct stat st;
+    // names come from the directory listing and are null terminated
+    if (::fstatat(dir_fd, name.data(), &st, follow_symlinks ? 0 : AT_SYMLINK_NOFOLLOW) != 0)
+        return false;
+    mode = st.st_mode;
+    return true;
+}
+#else
+// entries are passed to the handlers in batches of this size
+constexpr size_t batch_size = 256;
+
+template<typename F>
+list_directory_rc read_directory(const std::filesystem::path& d, F&& process_entry)
 {
     try
     {
@@ -97,14 +157,8 @@ list_directory_rc list_directory_subdirs_and_symlinks(
         if (!dir.is_directory())
             return list_directory_rc::not_a_directory;
 
-        std::filesystem::directory_iterator it(dir);
-
-        for (auto& p : it)
-        {
-            auto path = p.path();
-            if (std::filesystem::directory_entry de(path); de.is_directory() || de.is_symlink())
-                h(path);
-        }
+        for (const auto& p : std::filesystem::directory_iterator(dir))
+            process_entry(p);
     }
     catch (const std::filesystem::filesystem_error&)
     {
@@ -114,4 +168,108 @@ list_directory_rc list_directory_subdirs_and_symlinks(
     return list_directory_rc::done;
 }
 
+class name_batch
+{
+    std::vector<std::string> m_names;
+    std::vector<std::string_view> m_views;
+
+public:
+    bool add(std::string name)
+    {
+        m_names.emplace_back(std::move(name));
+        return m_names.size() >= batch_size;
+    }
+
+    std::span<const std::string_view> views()
+    {
+        m_views.assign(m_names.begin(), m_names.end());
+        return m_views;
+    }
+
+    bool empty() const { return m_names.empty(); }
+    void clear() { m_names.clear(); }
+};
+#endif
+} // namespace
+
+list_directory_rc list_directory_regular_files(const std::filesystem::path& d, const regular_files_handler& h)
+{
+#ifdef __linux__
+    std::vector<std::string_view> files;
+    return read_directory(d, [&h, &files](int fd, const auto& entries) {
+        files.clear();
+        for (const auto& [name, type] : entries)
+        {
+            // symbolic links to regular files are listed as well
+            if (mode_t mode; type == DT_REG
+                || ((type == DT_LNK || type == DT_UNKNOWN) && stat_at(fd, name, true, mode) && S_ISREG(mode)))
+                files.push_back(name);
+        }
+        if (!files.empty())
+            h(files);
+    });
+#else
+    name_batch files;
+    auto rc = read_directory(d, [&h, &files](const std::filesystem::directory_entry& p) {
+        if (p.is_regular_file() && files.add(p.path().filename().string()))
+        {
+            h(files.views());
+            files.clear();
+        }
+    });
+    if (!files.empty())
+        h(files.views());
+    return rc;
+#endif
+}
+
+list_directory_rc list_directory_subdirs_and_symlinks(
+    const std::filesystem::path& d, const subdirs_and_symlinks_handler& h)
+{
+#ifdef __linux__
+    std::vector<std::string_view> subdirs;
+    std::vector<std::string_view> symlinks;
+    return read_directory(d, [&h, &subdirs, &symlinks](int fd, const auto& entries) {
+        subdirs.clear();
+        symlinks.clear();
+        for (const auto& [name, type] : entries)
+        {
+            if (mode_t mode; type == DT_UNKNOWN && stat_at(fd, name, false, mode))
+            {
+                if (S_ISDIR(mode))
+                    subdirs.push_back(name);
+                else if (S_ISLNK(mode))
+                    symlinks.push_back(name);
+            }
+            else if (type == DT_DIR)
+                subdirs.push_back(name);
+            else if (type == DT_LNK)
+                symlinks.push_back(name);
+        }
+        if (!subdirs.empty() || !symlinks.empty())
+            h(subdirs, symlinks);
+    });
+#else
+    name_batch subdirs;
+    name_batch symlinks;
+    const auto flush = [&h, &subdirs, &symlinks]() {
+        h(subdirs.views(), symlinks.views());
+        subdirs.clear();
+        symlinks.clear();
+    };
+    auto rc = read_directory(d, [&subdirs, &symlinks, &flush](const std::filesystem::directory_entry& p) {
+        bool full = false;
+        if (p.is_symlink())
+            full = symlinks.add(p.path().filename().string());
+        else if (p.is_directory())
+            full = subdirs.add(p.path().filename().string());
+        if (full)
+            flush();
+    });
+    if (!subdirs.empty() || !symlinks.empty())
+        flush();
+    return rc;
+#endif
+}
+
 } // namespace hlasm_plugin::utils::path
@@ -12,10 +12,141 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "utils/filesystem_content_loader.h"
 #include "utils/path.h"
+#include "utils/path_conversions.h"
+#include "utils/platform.h"
 
 using namespace hlasm_plugin::utils::path;
 
 TEST(path, current_path) { EXPECT_NO_THROW(current_path()); }
+
+namespace {
+std::vector<std::string> sorted(std::vector<std::string> v)
+{
+    std::ranges::sort(v);
+    return v;
+}
+
+class temporary_directory
+{
+    std::filesystem::path m_path;
+
+public:
+    temporary_directory()
+        : m_path(std::filesystem::temp_directory_path()
+              / ("hlasm_path_test_" + std::string(testing::UnitTest::GetInstance()->current_test_info()->name())))
+    {
+        std::filesystem::remove_all(m_path);
+        std::filesystem::create_directories(m_path);
+    }
+    ~temporary_directory()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(m_path, ec);
+    }
+
+    const std::filesystem::path& get() const { return m_path; }
+
+    void create_file(const std::string& name) const { std::ofstream(m_path / name) << name; }
+};
+} // namespace
+
+TEST(path, list_directory)
+{
+    if (hlasm_plugin::utils::platform::is_web())
+        GTEST_SKIP();
+
+    temporary_directory dir;
+    dir.create_file("MAC1");
+    dir.create_file("MAC 2");
+    std::filesystem::create_directory(dir.get() / "sub");
+    const bool links = !hlasm_plugin::utils::platform::is_windows();
+    if (links)
+    {
+        std::filesystem::create_symlink("MAC1", dir.get() / "link_file");
+        std::filesystem::create_directory_symlink("sub", dir.get() / "link_dir");
+    }
+
+    std::vector<std::string> files;
+    EXPECT_EQ(list_directory_regular_files(dir.get(),
+                  [&files](std::span<const std::string_view> names) {
+                      files.insert(files.end(), names.begin(), names.end());
+                  }),
+        list_directory_rc::done);
+
+    std::vector<std::string> subdirs;
+    std::vector<std::string> symlinks;
+    EXPECT_EQ(list_directory_subdirs_and_symlinks(dir.get(),
+                  [&subdirs, &symlinks](std::span<const std::string_view> d, std::span<const std::string_view> l) {
+                      subdirs.insert(subdirs.end(), d.begin(), d.end());
+                      symlinks.insert(symlinks.end(), l.begin(), l.end());
+                  }),
+        list_directory_rc::done);
+
+    if (links)
+    {
+        EXPECT_EQ(sorted(files), (std::vector<std::string> { "MAC 2", "MAC1", "link_file" }));
+        EXPECT_EQ(sorted(symlinks), (std::vector<std::string> { "link_dir", "link_file" }));
+    }
+    else
+    {
+        EXPECT_EQ(sorted(files), (std::vector<std::string> { "MAC 2", "MAC1" }));
+        EXPECT_TRUE(symlinks.empty());
+    }
+    EXPECT_EQ(subdirs, std::vector<std::string> { "sub" });
+}
+
+TEST(path, list_directory_failures)
+{
+    if (hlasm_plugin::utils::platform::is_web())
+        GTEST_SKIP();
+
+    temporary_directory dir;
+    dir.create_file("FILE");
+
+    const auto ignore = [](auto...) {};
+    EXPECT_EQ(list_directory_regular_files(dir.get() / "missing", ignore), list_directory_rc::not_exists);
+    EXPECT_EQ(list_directory_regular_files(dir.get() / "FILE", ignore), list_directory_rc::not_a_directory);
+    EXPECT_EQ(list_directory_subdirs_and_symlinks(dir.get() / "missing", ignore), list_directory_rc::not_exists);
+    EXPECT_EQ(list_directory_subdirs_and_symlinks(dir.get() / "FILE", ignore), list_directory_rc::not_a_directory);
+}
+
+TEST(path, list_subdirectories_through_link_cycle)
+{
+    if (hlasm_plugin::utils::platform::is_web() || hlasm_plugin::utils::platform::is_windows())
+        GTEST_SKIP();
+
+    using namespace hlasm_plugin::utils::resource;
+
+    temporary_directory dir;
+    std::filesystem::create_directory(dir.get() / "sub");
+    std::filesystem::create_directory_symlink("..", dir.get() / "sub" / "back");
+
+    const auto canonical_dir = std::filesystem::canonical(dir.get());
+    const auto list = [](const std::filesystem::path& p) {
+        const auto [entries, rc] = filesystem_content_loader().list_directory_subdirs_and_symlinks(
+            resource_location(path_to_uri(p.string())));
+        EXPECT_EQ(rc, list_directory_rc::done);
+
+        std::vector<std::string> result;
+        for (const auto& [canonical_path, _] : entries)
+            result.push_back(canonical_path);
+        return sorted(std::move(result));
+    };
+
+    // the link to the parent is resolved
+    EXPECT_EQ(list(dir.get() / "sub"), std::vector<std::string> { canonical_dir.string() });
+    // subdirectories listed through the link and around the cycle get the canonical path
+    EXPECT_EQ(list(dir.get() / "sub" / "back"),
+        (std::vector<std::string> { (canonical_dir / "sub").string() }));
+    EXPECT_EQ(list(dir.get() / "sub" / "back" / "sub" / "back"),
+        (std::vector<std::string> { (canonical_dir / "sub").string() }));
+}